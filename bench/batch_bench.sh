@@ -0,0 +1,51 @@
+#!/bin/bash
+
+#   ------------------------------------------------------------
+#    batch_bench.sh
+#
+#    Compiles copies of the small test programs once with a
+#    brainc process per file, then in batch mode with 1 up to
+#    the number of cores worth of jobs, showing throughput.
+#    Usage: batch_bench.sh [copies of each program, default 8]
+#   ------------------------------------------------------------
+
+
+# Get the root directory and set all the appropriate directories from there.
+ROOT_DIR="$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && cd ../ && pwd )"
+
+BRAINC="$ROOT_DIR/bin/brainc"
+TEMP="$ROOT_DIR/bench/temp.$$"
+COPIES=${1:-8}
+
+test ! -f $BRAINC && exit 1
+
+# Make uniquely named copies of everything but give-you-up, which takes seconds on it's own.
+mkdir -p $TEMP/in $TEMP/out
+
+for INPUT in "$ROOT_DIR"/test/input/*.bf; do
+    NAME=$(basename $INPUT .bf)
+    test $NAME == give-you-up && continue
+    for i in $(seq $COPIES); do cp $INPUT $TEMP/in/$NAME-$i.bf; done
+done
+
+FILES=$(ls $TEMP/in/*.bf | wc -l)
+
+# Run a command and print the files per second it managed.
+rate() {
+    local s=$(date +%s%N)
+    "$@" > /dev/null 2>&1
+    local ms=$(( ($(date +%s%N) - s) / 1000000 ))
+    awk -v l="$LABEL" -v ms=$ms -v n=$FILES 'BEGIN { printf "%-24s %8d ms %10.1f files/s\n", l, ms, n * 1000 / ms }'
+}
+
+echo "$FILES files"
+
+LABEL="process per file"
+rate bash -c "for f in $TEMP/in/*.bf; do $BRAINC \$f -o $TEMP/out/\$(basename \$f .bf); done"
+
+for J in $(seq $(nproc)); do
+    LABEL="batch, $J jobs"
+    rate $BRAINC --batch $TEMP/in/*.bf -o $TEMP/out --jobs=$J
+done
+
+rm -rf $TEMP
@@ -0,0 +1,485 @@
+// ------------------------------------------------------------
+//  bench.cpp
+//
+//  Entry point for brainbench, the benchmark harness. Builds
+//  every workload in bench/input at each level and in each of
+//  brainc's modes, runs it, and checks it's output. The run
+//  and compile times, peak memory and binary sizes go to a
+//  JSON file, and are compared against a stored baseline so
+//  that regressions past a threshold get flagged.
+// ------------------------------------------------------------
+
+// Include statments.
+#include <map>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+#include <cstdio>
+#include <cstdlib>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+
+// How a workload gets built and run. Compiled modes build an executable with brainc first, the others are given
+// the source straight away.
+struct mode {
+    const char* name;
+    bool compiled;
+    std::vector<std::string> flags;
+};
+
+static const std::vector<mode> MODES = {
+    {"native", true, {"--native"}},
+    {"outline", true, {"--native", "--outline"}},
+    {"bytecode", true, {"--bytecode"}},
+    {"executor", true, {"--executor"}},
+    {"jit", false, {"--jit"}},
+    {"vm", false, {}},
+};
+
+// One workload built one way. Anything that doesn't apply, like the compile time of the vm, is -1.
+struct result {
+    std::string workload, mode;
+    int level = 0;
+    double compile_ms = -1, run_ms = -1;
+    long rss_kb = -1, size = -1;
+    bool ok = false;
+};
+
+// Once a compile or run has taken this long in total, it's timing is steady enough and the rest of the runs are skipped.
+static const double RUN_CAP_MS = 10000;
+
+// Below these, a difference from the baseline is put down to noise however big it is relatively.
+static const double TIME_FLOOR_MS = 10;
+static const long RSS_FLOOR_KB = 1024;
+
+static const std::string USAGE = "\x1B[33mUsage:\033[0m brainbench [-h] [--runs=<n>] [--threshold=<percent>] [--timeout=<s>] [--only=<workloads>] [--modes=<modes>] [--levels=<levels>] [--json=<file>] [--baseline=<file>] [--update-baseline]\n";
+
+static const std::string OPTIONS = "Options:\n"
+                                   "  -h, --help           Display this information.\n"
+                                   "  --runs=<n>           Run each build up to n times, or for 10s, and keep the fastest. 3 is default.\n"
+                                   "  --threshold=<percent>\n"
+                                   "                       Flag anything this much worse than the baseline. 10 is default.\n"
+                                   "  --timeout=<s>        Kill a compile or run taking longer than this. 120 is default.\n"
+                                   "  --only=<workloads>   Comma separated workloads to run, named after their files in bench/input.\n"
+                                   "  --modes=<modes>      Comma separated modes, out of native, outline, bytecode, executor, jit and vm.\n"
+                                   "  --levels=<levels>    Comma separated optimization levels. 0,1,2,3 is default.\n"
+                                   "  --json=<file>        Where the results go. bench.json is default.\n"
+                                   "  --baseline=<file>    The baseline to compare against, bench/baseline.json by default, or none if empty.\n"
+                                   "  --update-baseline    Write the results into the baseline, keeping any entries that weren't run.\n";
+
+
+// ------------------------------------------------------------
+//  split
+//
+//  Split a comma separated list.
+// ------------------------------------------------------------
+static std::vector<std::string> split(const std::string& list) {
+
+    std::vector<std::string> items;
+    std::stringstream ss(list);
+
+    for (std::string item; std::getline(ss, item, ',');) {
+        if (!item.empty()) items.push_back(item);
+    }
+
+    return items;
+}
+
+
+// ------------------------------------------------------------
+//  read_file
+//
+//  The whole of a file, or nothing if it can't be read.
+// ------------------------------------------------------------
+static std::string read_file(const std::filesystem::path& path) {
+
+    std::ifstream ifs(path, std::ios::binary);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+
+    return ss.str();
+}
+
+
+// ------------------------------------------------------------
+//  execute
+//
+//  Run a command with stdin from the given file, collecting
+//  it's stdout into out if given. The wall time and the peak
+//  resident memory of the command alone are filled in, and
+//  the exit status returned, or 128 plus the signal that
+//  killed it. The alarm survives the exec, so a command that
+//  runs too long is killed by SIGALRM.
+// ------------------------------------------------------------
+static int execute(const std::vector<std::string>& args, const std::string& in, std::string* out, unsigned timeout,
+                   double& ms, long& rss_kb) {
+
+    int fds[2];
+    if (pipe(fds) != 0) return -1;
+
+    std::vector<char*> argv;
+    for (const std::string& arg : args) argv.push_back((char*) arg.c_str());
+    argv.push_back(nullptr);
+
+    auto start = std::chrono::steady_clock::now();
+    pid_t pid = fork();
+
+    if (pid == 0) {
+        int in_fd = open(in.c_str(), O_RDONLY);
+        if (in_fd >= 0) dup2(in_fd, STDIN_FILENO);
+        dup2(fds[1], STDOUT_FILENO);
+        close(fds[0]);
+        close(fds[1]);
+
+        alarm(timeout);
+        execv(argv[0], argv.data());
+        _exit(127);
+    }
+
+    close(fds[1]);
+    if (pid < 0) {
+        close(fds[0]);
+        return -1;
+    }
+
+    char buf[65536];
+    ssize_t n;
+
+    while ((n = read(fds[0], buf, sizeof(buf))) != 0) {
+        if (n > 0 && out) out->append(buf, n);
+        else if (n < 0 && errno != EINTR) break;
+    }
+
+    close(fds[0]);
+
+    int status = 0;
+    rusage usage{};
+    wait4(pid, &status, 0, &usage);
+
+    ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    rss_kb = usage.ru_maxrss;
+
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+}
+
+
+// ------------------------------------------------------------
+//  measure
+//
+//  Build a workload one way, then run it the given number of
+//  times, or until RUN_CAP_MS is up, keeping the fastest. Each
+//  run has to produce the expected output for it to be ok.
+//  The compile is repeated the same way.
+// ------------------------------------------------------------
+static result measure(const std::filesystem::path& bin, const std::filesystem::path& bench_dir, const std::filesystem::path& temp,
+                      const std::string& name, const mode& m, int level, int runs, unsigned timeout) {
+
+    result res;
+    res.workload = name, res.mode = m.name, res.level = level;
+
+    std::string source = (bench_dir / "input" / (name + ".bf")).string();
+    std::string expected = read_file(bench_dir / "output" / (name + ".out"));
+
+    std::string in = (bench_dir / "stdin" / (name + ".in")).string();
+    if (!std::filesystem::exists(in)) in = "/dev/null";
+
+    std::string opt = "-O" + std::to_string(level);
+    std::vector<std::string> cmd;
+
+    if (m.compiled) {
+        std::string exe = (temp / (name + "." + m.name + opt)).string();
+
+        cmd = {(bin / "brainc").string(), opt, source, "-o", exe};
+        cmd.insert(cmd.begin() + 2, m.flags.begin(), m.flags.end());
+
+        // Compiles are timed the same way as runs.
+        double total = 0;
+
+        for (int i = 0; i < runs && total < RUN_CAP_MS; i++) {
+            double ms;
+            long rss_kb;
+
+            if (execute(cmd, "/dev/null", nullptr, timeout, ms, rss_kb) != 0) return res;
+
+            total += ms;
+            if (res.compile_ms < 0 || ms < res.compile_ms) res.compile_ms = ms;
+        }
+
+        std::error_code ec;
+        res.size = std::filesystem::file_size(exe, ec);
+        cmd = {exe};
+    } else if (std::string(m.name) == "jit") {
+        // The JIT compiles as part of the run, so it's time includes the compile.
+        cmd = {(bin / "brainc").string(), opt, source};
+        cmd.insert(cmd.begin() + 2, m.flags.begin(), m.flags.end());
+    } else {
+        cmd = {(bin / "brainvm").string(), opt, source};
+    }
+
+    res.ok = true;
+    double total = 0;
+
+    for (int i = 0; i < runs && total < RUN_CAP_MS; i++) {
+        std::string out;
+        double ms;
+        long rss_kb;
+
+        int status = execute(cmd, in, &out, timeout, ms, rss_kb);
+        if (status != 0 || out != expected) res.ok = false;
+
+        total += ms;
+
+        if (res.run_ms < 0 || ms < res.run_ms) res.run_ms = ms;
+        if (res.rss_kb < 0 || rss_kb < res.rss_kb) res.rss_kb = rss_kb;
+    }
+
+    return res;
+}
+
+
+// ------------------------------------------------------------
+//  cell
+//
+//  A measurement as shown in the table, - if it doesn't apply.
+// ------------------------------------------------------------
+static std::string cell(double value, int precision) {
+
+    if (value < 0) return "-";
+
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", precision, value);
+    return buf;
+}
+
+
+// ------------------------------------------------------------
+//  key
+//
+//  What a result is matched up to the baseline by.
+// ------------------------------------------------------------
+static std::string key(const result& res) {
+    return res.workload + " " + res.mode + " -O" + std::to_string(res.level);
+}
+
+
+// ------------------------------------------------------------
+//  write_json
+//
+//  One result to a line, so that baselines diff nicely.
+// ------------------------------------------------------------
+static bool write_json(const std::string& path, const std::vector<result>& results, int runs) {
+
+    std::ofstream ofs(path);
+    if (!ofs) return false;
+
+    auto number = [](double value, int precision) { return value < 0 ? std::string("null") : cell(value, precision); };
+
+    ofs << "{\n  \"runs\": " << runs << ",\n  \"results\": [\n";
+
+    for (size_t i = 0; i < results.size(); i++) {
+        const result& res = results[i];
+
+        ofs << "    {\"workload\": \"" << res.workload << "\", \"mode\": \"" << res.mode << "\", \"level\": " << res.level
+            << ", \"compile_ms\": " << number(res.compile_ms, 1) << ", \"run_ms\": " << number(res.run_ms, 1)
+            << ", \"rss_kb\": " << number(res.rss_kb, 0) << ", \"size\": " << number(res.size, 0)
+            << ", \"ok\": " << (res.ok ? "true" : "false") << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+
+    ofs << "  ]\n}\n";
+    return (bool) ofs;
+}
+
+
+// ------------------------------------------------------------
+//  read_json
+//
+//  Read back the results write_json wrote, which is all this
+//  understands, keyed for comparing.
+// ------------------------------------------------------------
+static std::map<std::string, result> read_json(const std::string& path) {
+
+    std::map<std::string, result> results;
+    std::ifstream ifs(path);
+
+    // The value of a field in the line, without the quotes for a string.
+    auto field = [](const std::string& line, const std::string& name) {
+        size_t at = line.find("\"" + name + "\": ");
+        if (at == std::string::npos) return std::string();
+
+        at += name.size() + 4;
+        std::string value = line.substr(at, line.find_first_of(",}", at) - at);
+
+        if (value.size() >= 2 && value.front() == '"') value = value.substr(1, value.size() - 2);
+        return value;
+    };
+
+    auto number = [](const std::string& value) { return value.empty() || value == "null" ? -1 : std::stod(value); };
+
+    for (std::string line; std::getline(ifs, line);) {
+        if (line.find("\"workload\"") == std::string::npos) continue;
+
+        result res;
+        res.workload = field(line, "workload");
+        res.mode = field(line, "mode");
+        res.level = (int) number(field(line, "level"));
+        res.compile_ms = number(field(line, "compile_ms"));
+        res.run_ms = number(field(line, "run_ms"));
+        res.rss_kb = (long) number(field(line, "rss_kb"));
+        res.size = (long) number(field(line, "size"));
+        res.ok = field(line, "ok") == "true";
+
+        results[key(res)] = res;
+    }
+
+    return results;
+}
+
+
+// ------------------------------------------------------------
+//  compare
+//
+//  Add a line to regressions for every measurement that got
+//  worse than the baseline by more than the threshold, and by
+//  more than the noise floor.
+// ------------------------------------------------------------
+static void compare(const result& now, const result& then, double threshold, std::vector<std::string>& regressions) {
+
+    auto check = [&](const char* name, double a, double b, double floor) {
+        if (a < 0 || b < 0 || a <= b * (1 + threshold / 100) || a - b <= floor) return;
+
+        char buf[256];
+        snprintf(buf, sizeof(buf), "%s %s: %.1f -> %.1f (+%.0f%%)", key(now).c_str(), name, b, a, b > 0 ? (a / b - 1) * 100 : 100.0);
+        regressions.push_back(buf);
+    };
+
+    check("compile_ms", now.compile_ms, then.compile_ms, TIME_FLOOR_MS);
+    check("run_ms", now.run_ms, then.run_ms, TIME_FLOOR_MS);
+    check("rss_kb", now.rss_kb, then.rss_kb, RSS_FLOOR_KB);
+    check("size", now.size, then.size, 0);
+}
+
+
+int main(int argc, char** argv) {
+
+    // The workloads live in the source tree's bench directory, and the tools next to us in bin.
+    std::error_code ec;
+    std::filesystem::path bin = std::filesystem::read_symlink("/proc/self/exe", ec).parent_path();
+    std::filesystem::path bench_dir = bin.parent_path() / "bench";
+
+    int runs = 3;
+    unsigned timeout = 120;
+    double threshold = 10;
+    bool update = false;
+    std::string json = "bench.json", baseline = (bench_dir / "baseline.json").string();
+    std::vector<std::string> only, modes, levels{"0", "1", "2", "3"};
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "-h" || arg == "--help") {
+            std::cout << USAGE << OPTIONS;
+            return 0;
+        }
+
+        if (arg.rfind("--runs=", 0) == 0) runs = std::max(1, atoi(value.c_str()));
+        else if (arg.rfind("--threshold=", 0) == 0) threshold = atof(value.c_str());
+        else if (arg.rfind("--timeout=", 0) == 0) timeout = atoi(value.c_str());
+        else if (arg.rfind("--only=", 0) == 0) only = split(value);
+        else if (arg.rfind("--modes=", 0) == 0) modes = split(value);
+        else if (arg.rfind("--levels=", 0) == 0) levels = split(value);
+        else if (arg.rfind("--json=", 0) == 0) json = value;
+        else if (arg.rfind("--baseline=", 0) == 0) baseline = value;
+        else if (arg == "--update-baseline") update = true;
+        else {
+            std::cerr << "\x1B[31merror:\033[0m unknown option " << arg << "\n" << USAGE;
+            return 2;
+        }
+    }
+
+    // Every workload, unless only some were asked for.
+    std::vector<std::string> workloads;
+
+    for (const auto& entry : std::filesystem::directory_iterator(bench_dir / "input", ec)) {
+        std::string name = entry.path().stem().string();
+
+        if (entry.path().extension() == ".bf" && (only.empty() || std::find(only.begin(), only.end(), name) != only.end())) {
+            workloads.push_back(name);
+        }
+    }
+
+    std::sort(workloads.begin(), workloads.end());
+
+    if (workloads.empty()) {
+        std::cerr << "\x1B[31merror:\033[0m no workloads found in " << (bench_dir / "input").string() << "\n";
+        return 2;
+    }
+
+    // Builds go to a directory of our own, removed at the end.
+    std::filesystem::path temp = std::filesystem::temp_directory_path() / ("brainbench." + std::to_string(getpid()));
+    std::filesystem::create_directories(temp);
+
+    std::map<std::string, result> base = baseline.empty() ? std::map<std::string, result>() : read_json(baseline);
+    std::vector<result> results;
+    std::vector<std::string> regressions;
+    bool all_ok = true;
+
+    printf("%-12s %-9s %-4s %12s %12s %10s %10s\n", "workload", "mode", "opt", "compile ms", "run ms", "rss KiB", "bytes");
+
+    for (const std::string& name : workloads) {
+        for (const mode& m : MODES) {
+            if (!modes.empty() && std::find(modes.begin(), modes.end(), m.name) == modes.end()) continue;
+
+            for (const std::string& level : levels) {
+                result res = measure(bin, bench_dir, temp, name, m, atoi(level.c_str()), runs, timeout);
+
+                printf("%-12s %-9s -O%-2d %12s %12s %10s %10s%s\n", res.workload.c_str(), res.mode.c_str(), res.level,
+                       cell(res.compile_ms, 1).c_str(), cell(res.run_ms, 1).c_str(), cell(res.rss_kb, 0).c_str(), cell(res.size, 0).c_str(),
+                       res.ok ? "" : "  \x1B[31mwrong output\033[0m");
+                fflush(stdout);
+
+                auto then = base.find(key(res));
+                if (then != base.end()) compare(res, then->second, threshold, regressions);
+
+                all_ok = all_ok && res.ok;
+                results.push_back(res);
+            }
+        }
+    }
+
+    std::filesystem::remove_all(temp, ec);
+
+    if (!write_json(json, results, runs)) {
+        std::cerr << "\x1B[31merror:\033[0m can't write " << json << "\n";
+        return 2;
+    }
+
+    for (const std::string& line : regressions) printf("REGRESSION %s\n", line.c_str());
+
+    // Entries that weren't run this time are kept, so a baseline can be updated a few workloads at a time.
+    if (update && !baseline.empty()) {
+        for (const result& res : results) base[key(res)] = res;
+
+        std::vector<result> merged;
+        for (const auto& entry : base) merged.push_back(entry.second);
+
+        if (!write_json(baseline, merged, runs)) {
+            std::cerr << "\x1B[31merror:\033[0m can't write " << baseline << "\n";
+            return 2;
+        }
+
+        return all_ok ? 0 : 1;
+    }
+
+    return all_ok && regressions.empty() ? 0 : 1;
+}
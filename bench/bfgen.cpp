@@ -0,0 +1,236 @@
+// ------------------------------------------------------------
+//  bfgen.cpp
+//
+//  Entry point for bfgen, which writes out a random bf program
+//  of a given size, nesting depth, number of loops and share
+//  of comments, for testing how the compiler scales. Programs
+//  are streamed out, so they can be far bigger than memory.
+//  Every program ends, printing a little along the way.
+// ------------------------------------------------------------
+
+// Include statments.
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+
+
+// Cells the straight line code wanders over, so the head never leaves a small window.
+static const int WINDOW = 16;
+
+// Loops spread through the program, each of which ends however the cells were left. The offset is the furthest
+// the loop moves right, and the loops that move left start from one cell in.
+struct loop_template {
+    const char* text;
+    int left, right;
+};
+
+static const loop_template LOOPS[] = {
+    {"[-]", 0, 0},
+    {"[->+<]", 0, 1},
+    {"[->+>++<<]", 0, 2},
+    {"[-<+>]", 1, 0},
+    {"[-[->+<]]", 0, 1},
+    {"[>[-]<-]", 0, 1},
+};
+
+// Words for comments, none of which have any bf in them.
+static const char* WORDS[] = {"the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "while", "adding", "cells",
+                              "moving", "right", "then", "back", "again", "until", "zero"};
+
+static const std::string USAGE = "\x1B[33mUsage:\033[0m bfgen [-h] [--size=<bytes>] [--depth=<n>] [--loops=<n>] [--comments=<percent>] [--seed=<n>] [-o <output file>]\n";
+
+static const std::string OPTIONS = "Options:\n"
+                                   "  -h, --help           Display this information.\n"
+                                   "  -o <output file>     Where the program goes, stdout by default.\n"
+                                   "  --size=<bytes>       Size of the program, with an optional K, M or G suffix. 64K is default.\n"
+                                   "  --depth=<n>          Nest this many loops inside one another in the middle of the program.\n"
+                                   "  --loops=<n>          Loops to spread through the rest of the program. One every 64 bytes is default.\n"
+                                   "  --comments=<percent> Share of the program that's comments, as words and line breaks. 0 is default.\n"
+                                   "  --seed=<n>           Seed for the random choices, the same seed gives the same program.\n";
+
+
+// A small writer that buffers it's output and counts the bytes that went into the program, and which were comments.
+class writer {
+public:
+
+    uint64_t bytes = 0, comment_bytes = 0;
+
+    writer(std::ostream& o): os(o) {};
+
+    ~writer() { flush(); }
+
+    void code(const std::string& s) { put(s); }
+
+    void comment(const std::string& s) {
+        put(s);
+        comment_bytes += s.size();
+    }
+
+    void flush() {
+        os.write(buf.data(), buf.size());
+        buf.clear();
+    }
+
+private:
+
+    std::ostream& os;
+    std::string buf;
+    uint64_t column = 0;
+
+    void put(const std::string& s) {
+        buf += s;
+        bytes += s.size();
+
+        // Code is broken up into lines too, but those line breaks are left out of the comment count.
+        column += s.size();
+        if (column >= 80) buf += '\n', bytes++, column = 0;
+
+        if (buf.size() >= (1 << 20)) flush();
+    }
+};
+
+
+// ------------------------------------------------------------
+//  next
+//
+//  xorshift64, plenty for picking between a few options.
+// ------------------------------------------------------------
+static uint64_t next(uint64_t& state) {
+
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    return state;
+}
+
+
+// ------------------------------------------------------------
+//  parse_size
+//
+//  A number with an optional K, M or G suffix.
+// ------------------------------------------------------------
+static uint64_t parse_size(const std::string& s) {
+
+    char* end;
+    uint64_t n = strtoull(s.c_str(), &end, 10);
+
+    switch (*end) {
+        case 'G': case 'g': n <<= 10; [[fallthrough]];
+        case 'M': case 'm': n <<= 10; [[fallthrough]];
+        case 'K': case 'k': n <<= 10;
+    }
+
+    return n;
+}
+
+
+// ------------------------------------------------------------
+//  filler
+//
+//  Straight line code and loops until the program has grown
+//  to the given size, with comments mixed in until they make
+//  up their share of it.
+// ------------------------------------------------------------
+static void filler(writer& out, uint64_t size, uint64_t loops, double comments, uint64_t& rng, int& head) {
+
+    uint64_t start = out.bytes, end = out.bytes + size;
+    uint64_t spacing = loops ? std::max<uint64_t>(size / loops, 1) : UINT64_MAX, next_loop = start + spacing / 2;
+
+    while (out.bytes < end) {
+        uint64_t r = next(rng);
+
+        if (out.bytes >= next_loop) {
+            const loop_template& loop = LOOPS[r % (sizeof(LOOPS) / sizeof(LOOPS[0]))];
+
+            // Line the head up so the loop stays inside the window.
+            int target = std::clamp(head, loop.left, WINDOW - 1 - loop.right);
+            out.code(std::string(std::abs(target - head), target > head ? '>' : '<'));
+            head = target;
+
+            out.code(loop.text);
+            next_loop += spacing;
+        } else if (r % 16 == 0) {
+            out.code(".");
+        } else if (r % 4 == 0) {
+            int by = 1 + (r >> 8) % 3;
+            int target = std::clamp(head + ((r >> 4) % 2 ? by : -by), 0, WINDOW - 1);
+
+            out.code(std::string(std::abs(target - head), target > head ? '>' : '<'));
+            head = target;
+        } else {
+            out.code(std::string(1 + (r >> 8) % 8, (r >> 4) % 2 ? '+' : '-'));
+        }
+
+        while (comments > 0 && out.comment_bytes < comments * out.bytes) {
+            out.comment(std::string(WORDS[next(rng) % (sizeof(WORDS) / sizeof(WORDS[0]))]) + " ");
+        }
+    }
+}
+
+
+int main(int argc, char** argv) {
+
+    uint64_t size = 64 << 10, depth = 0, loops = UINT64_MAX, seed = 1;
+    double comments = 0;
+    std::string output;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "-h" || arg == "--help") {
+            std::cout << USAGE << OPTIONS;
+            return 0;
+        }
+
+        if (arg == "-o" && i + 1 < argc) output = argv[++i];
+        else if (arg.rfind("--size=", 0) == 0) size = parse_size(value);
+        else if (arg.rfind("--depth=", 0) == 0) depth = parse_size(value);
+        else if (arg.rfind("--loops=", 0) == 0) loops = parse_size(value);
+        else if (arg.rfind("--comments=", 0) == 0) comments = std::clamp(atof(value.c_str()), 0.0, 90.0) / 100;
+        else if (arg.rfind("--seed=", 0) == 0) seed = std::max<uint64_t>(strtoull(value.c_str(), nullptr, 10), 1);
+        else {
+            std::cerr << "\x1B[31merror:\033[0m unknown option " << arg << "\n" << USAGE;
+            return 2;
+        }
+    }
+
+    std::ofstream ofs;
+    if (!output.empty()) {
+        ofs.open(output, std::ios::binary);
+
+        if (!ofs) {
+            std::cerr << "\x1B[31merror:\033[0m can't write " << output << "\n";
+            return 1;
+        }
+    }
+
+    writer out(output.empty() ? std::cout : ofs);
+    uint64_t rng = seed * 0x9E3779B97F4A7C15ull;
+    int head = 0;
+
+    // The nest takes 3 bytes a level, and the rest is split either side of it.
+    uint64_t nest = 3 * depth;
+    uint64_t rest = size > nest ? size - nest : 0;
+    if (loops == UINT64_MAX) loops = rest / 64;
+
+    filler(out, rest / 2, loops / 2, comments, rng, head);
+
+    // The outermost loop runs once and clears it's cell, so none of the ones inside it ever do.
+    if (depth > 0) {
+        out.code("[-]+");
+        for (uint64_t d = 0; d < depth; d++) out.code("[-");
+        for (uint64_t d = 0; d < depth; d++) out.code("]");
+    }
+
+    filler(out, rest - rest / 2, loops - loops / 2, comments, rng, head);
+    out.code(".\n");
+
+    out.flush();
+    return (output.empty() ? std::cout.good() : ofs.good()) ? 0 : 1;
+}
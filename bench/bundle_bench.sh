@@ -0,0 +1,77 @@
+#!/bin/bash
+
+#   ------------------------------------------------------------
+#    bundle_bench.sh
+#
+#    Compares many small programs built as separate executables
+#    against one --bundle of them: the size on disk, the memory
+#    they take all running at once, and the time to start each
+#    in turn. The programs come from bfgen, with a read of stdin
+#    first so they can be held open while they're measured. The
+#    starts are cold when run as root, with the page cache
+#    dropped first, otherwise they're warm.
+#    Usage: bundle_bench.sh [programs, default 100]
+#   ------------------------------------------------------------
+
+
+# Get the root directory and set all the appropriate directories from there.
+ROOT_DIR="$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && cd ../ && pwd )"
+
+BRAINC="$ROOT_DIR/bin/brainc"
+BFGEN="$ROOT_DIR/bin/bfgen"
+TEMP="$ROOT_DIR/bench/temp.$$"
+N=${1:-100}
+
+test ! -f $BRAINC -o ! -f $BFGEN && exit 1
+
+mkdir -p $TEMP/in $TEMP/separate $TEMP/bundle
+
+for i in $(seq $N); do
+    { printf ","; $BFGEN --size=${SIZE:-4K} --seed=$i; } > $TEMP/in/tool$i.bf
+done
+
+$BRAINC --batch $TEMP/in/*.bf -o $TEMP/separate &> /dev/null
+$BRAINC --bundle $TEMP/in/*.bf -o $TEMP/bundle/bundle &> /dev/null
+for i in $(seq $N); do ln -s bundle $TEMP/bundle/tool$i; done
+
+# Drop the page cache if we're allowed to, so every start has to read it's executable back in.
+COLD=no
+test -w /proc/sys/vm/drop_caches && COLD=yes
+
+# Start every program in the directory once, one after another, in milliseconds.
+starts() {
+    test $COLD == yes && sync && echo 3 > /proc/sys/vm/drop_caches
+    local s=$(date +%s%N)
+    for i in $(seq $N); do $1/tool$i < /dev/null > /dev/null; done
+    echo $(( ($(date +%s%N) - s) / 1000000 ))
+}
+
+# Hold every program open at once, waiting on a fifo that never has anything in it, and add up their RSS and PSS
+# in KiB. PSS splits each shared page between the processes sharing it, so it's what they cost together.
+memory() {
+    local pids=
+    mkfifo $TEMP/hold
+
+    for i in $(seq $N); do
+        $1/tool$i 0<> $TEMP/hold > /dev/null &
+        pids="$pids $!"
+    done
+
+    sleep 1
+    cat $(for p in $pids; do echo /proc/$p/smaps_rollup; done) 2> /dev/null \
+        | awk '/^Rss:/ { rss += $2 } /^Pss:/ { pss += $2 } END { printf "%d %d", rss, pss }'
+
+    kill $pids 2> /dev/null
+    wait 2> /dev/null
+    rm -f $TEMP/hold
+}
+
+SEPARATE_KB=$(( $(cat $TEMP/separate/* | wc -c) / 1024 ))
+BUNDLE_KB=$(( $(stat -c %s $TEMP/bundle/bundle) / 1024 ))
+
+echo "$N programs, cold starts: $COLD"
+printf "%-10s %12s %12s %12s %12s\n" "" "disk KiB" "rss KiB" "pss KiB" "starts ms"
+printf "%-10s %12s %12s %12s %12s\n" separate $SEPARATE_KB $(memory $TEMP/separate) $(starts $TEMP/separate)
+printf "%-10s %12s %12s %12s %12s\n" bundle $BUNDLE_KB $(memory $TEMP/bundle) $(starts $TEMP/bundle)
+
+rm -rf $TEMP
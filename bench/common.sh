@@ -0,0 +1,19 @@
+#   ------------------------------------------------------------
+#    common.sh
+#
+#    Helpers shared by the benchmark scripts, which source it
+#    once they've found ROOT_DIR.
+#   ------------------------------------------------------------
+
+
+# Time a command in milliseconds, keeping the best of 5 runs. It reads BEST_INPUT if that's set, otherwise nothing.
+best() {
+    local b=
+    for i in 1 2 3 4 5; do
+        local s=$(date +%s%N)
+        "$@" < ${BEST_INPUT:-/dev/null} > /dev/null 2>&1
+        local t=$(( ($(date +%s%N) - s) / 1000000 ))
+        test -z "$b" -o "$t" -lt "${b:-0}" && b=$t
+    done
+    echo $b
+}
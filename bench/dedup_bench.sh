@@ -0,0 +1,50 @@
+#!/bin/bash
+
+#   ------------------------------------------------------------
+#    dedup_bench.sh
+#
+#    Compares the size and run time of executables built with
+#    the cold copies of identical loops shared, against every
+#    copy inline with --no-dedup. The programs are copies of a
+#    handful of print routines, like machine generated bf, each
+#    run once at the top level. Set COPIES to the copies wanted
+#    and ROUTINES to how many different ones there are.
+#   ------------------------------------------------------------
+
+
+# Get the root directory and set all the appropriate directories from there.
+ROOT_DIR="$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && cd ../ && pwd )"
+
+BRAINC="$ROOT_DIR/bin/brainc"
+TEMP="$ROOT_DIR/bench/temp.$$"
+
+test ! -f $BRAINC && exit 1
+
+# Timing helpers, see common.sh.
+. "$ROOT_DIR/bench/common.sh"
+
+ROUTINES=${ROUTINES:-8}
+
+printf "%-8s %10s %14s %14s %12s %12s\n" "copies" "bytes" "shared bytes" "inline bytes" "shared ms" "inline ms"
+
+for N in ${COPIES:-16 64 256 1024}; do
+    awk -v copies=$N -v routines=$ROUTINES 'BEGIN {
+        for (c = 0; c < copies; c++) {
+            r = c % routines; s = "+[";
+            for (j = 0; j < 16; j++) {
+                s = s ">";
+                for (k = 0; k < 33 + (r * 7 + j * 13) % 90; k++) s = s "+";
+                s = s ".[-]<";
+            }
+            print s "-]";
+        }
+    }' > $TEMP.bf
+
+    $BRAINC $TEMP.bf --native -o $TEMP.shared &> /dev/null
+    $BRAINC $TEMP.bf --native --no-dedup -o $TEMP.inline &> /dev/null
+
+    printf "%-8s %10s %14s %14s %12s %12s\n" $N $(stat -c %s $TEMP.bf) $(stat -c %s $TEMP.shared) $(stat -c %s $TEMP.inline) \
+        $(best $TEMP.shared) $(best $TEMP.inline)
+done
+
+rm -f $TEMP.bf $TEMP.shared $TEMP.inline
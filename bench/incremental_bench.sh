@@ -0,0 +1,57 @@
+#!/bin/bash
+
+#   ------------------------------------------------------------
+#    incremental_bench.sh
+#
+#    Times rebuilding a big generated program with --incremental
+#    after a one line edit, against building it from scratch.
+#    The program is random runs of adds, moves, multiply loops
+#    and output after a read, so no two regions are alike, and
+#    the edit is to the middle line. Set LINES to change it's
+#    size, each is ~150 bytes.
+#   ------------------------------------------------------------
+
+
+# Get the root directory and set all the appropriate directories from there.
+ROOT_DIR="$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && cd ../ && pwd )"
+
+BRAINC="$ROOT_DIR/bin/brainc"
+TEMP="$ROOT_DIR/bench/temp.$$"
+
+test ! -f $BRAINC && exit 1
+
+# Time a command in milliseconds.
+ms() {
+    local s=$(date +%s%N)
+    "$@" > /dev/null 2>&1
+    echo $(( ($(date +%s%N) - s) / 1000000 ))
+}
+
+LINES=${LINES:-2000}
+
+awk -v lines=$LINES 'BEGIN {
+    srand(1); print ",";
+    for (l = 0; l < lines; l++) {
+        s = "";
+        for (i = 0; i < 30; i++) {
+            r = int(rand() * 6); n = 1 + int(rand() * 8); run = "";
+            for (j = 0; j < n; j++) run = run (r == 1 ? "-" : "+");
+            if (r <= 1) s = s run; else if (r == 2) s = s ">"; else if (r == 3) s = s "<"; else if (r == 4) s = s "[->" run "<]"; else s = s ".";
+        }
+        print s;
+    }
+}' > $TEMP.bf
+
+echo "program: $LINES lines, $(stat -c %s $TEMP.bf) bytes"
+
+printf "%-28s %10s\n" "build" "ms"
+printf "%-28s %10s\n" "--outline, from scratch" $(ms $BRAINC $TEMP.bf --native --outline -o $TEMP)
+printf "%-28s %10s\n" "--incremental, empty cache" $(ms $BRAINC $TEMP.bf --incremental --cache-dir=$TEMP.cache -o $TEMP)
+
+# Print an extra character partway through the middle line.
+sed -i "$(( LINES / 2 + 1 ))s/\./../" $TEMP.bf
+printf "%-28s %10s\n" "--incremental, one line edit" $(ms $BRAINC $TEMP.bf --incremental --cache-dir=$TEMP.cache -o $TEMP --stats-json=$TEMP.json)
+
+grep -o '"regions[a-z_]*": [0-9]*' $TEMP.json
+
+rm -rf $TEMP $TEMP.bf $TEMP.cache $TEMP.json
@@ -0,0 +1,1313 @@
+Prints the powers of two up to 2 to the 200 in decimal
+The 64 digit bignum is fully unrolled so this is also a large program
+
++>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>---------------
+----------------------------------------->++++++++++<<[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-------------------
+----------------------------->>>>[-]]<<<<<[->>>>>+>+<<<<<<]>>>>>>[-
+<<<<<<+>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.------------------
+------------------------------>>>>>[-]]<<<<<<[->>>>>>+>+<<<<<<<]>>>>>>>[-
+<<<<<<<+>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-----------------
+------------------------------->>>>>>[-]]<<<<<<<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-
+<<<<<<<<+>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.----------------
+-------------------------------->>>>>>>[-]]<<<<<<<<[-
+>>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.---------------
+--------------------------------->>>>>>>>[-]]<<<<<<<<<[-
+>>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<[-]+>[-]]<[-
+>+>+<<]>>[-<<+>>]<[<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.---
+--------------------------------------------->>>>>>>>>[-]]<<<<<<<<<<[-
+>>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<[<[-]+>[-]]<[-
+>+>+<<]>>[-<<+>>]<[<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.--
+---------------------------------------------->>>>>>>>>>[-]]<<<<<<<<<<<[-
+>>>>>>>>>>>+>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<[<[-]+>[-
+]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.------------
+------------------------------------>>>>>>>>>>>[-]]<<<<<<<<<<<<[-
+>>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<[<[-
+]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-----------
+------------------------------------->>>>>>>>>>>>[-]]<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.----------
+-------------------------------------->>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.---------
+--------------------------------------->>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.--------
+---------------------------------------->>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-------
+----------------------------------------->>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.------
+------------------------------------------>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-----
+------------------------------------------->>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.----
+-------------------------------------------->>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.---
+--------------------------------------------->>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.--
+---------------------------------------------->>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-
+----------------------------------------------->>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.
+------------------------------------------------>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++
+.------------------------------------------------>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[-
+>+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++++++
++.------------------------------------------------>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[-
+>+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++
+++.------------------------------------------------>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-
+]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++++
++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-
+]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++
+++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[-
+>+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++
++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[-
+>+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++
+++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-
+]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++
++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-
+]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++
+++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-
+]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++
++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-
+]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++
+++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-
+]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++
++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[
+-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++
+++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[
+<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++
++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]
+<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++
+++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++
++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++
+++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++
++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++
+++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++
++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++
+++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++
++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++
+++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++
++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++
+++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++
++++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++
+++++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++
++++++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++
+++++++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++
++++++++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++
+++++++++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++
++++++++++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++
+++++++++++++++++++++++++++++++++.-----------------------------------------------
+->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++
++++++++++++++++++++++++++++++++++.----------------------------------------------
+-->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++
+++++++++++++++++++++++++++++++++++.---------------------------------------------
+--->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++
++++++++++++++++++++++++++++++++++++.--------------------------------------------
+---->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++
+++++++++++++++++++++++++++++++++++++.-------------------------------------------
+----->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++
++++++++++++++++++++++++++++++++++++++.------------------------------------------
+------>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++
+++++++++++++++++++++++++++++++++++++++.-----------------------------------------
+------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++
++++++++++++++++++++++++++++++++++++++++.----------------------------------------
+-------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++
+++++++++++++++++++++++++++++++++++++++++.---------------------------------------
+--------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++
++++++++++++++++++++++++++++++++++++++++++.--------------------------------------
+---------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]+>[-]]<[-
+>+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++
+++++++++++++++++++++++++++++++++++++++++++.-------------------------------------
+----------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<[-]+[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++
++++++++++++++++++++++++++++++++++++++++++++.------------------------------------
+------------>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-]]<[-]++++++++++.[-
+]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-
+<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-
+<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-
+]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-
+<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-
+<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-
+]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-
+<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-
+]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-
+]>[-<+[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-
+<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-
+<+[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[-
+>>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-
+<+[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[-
+>+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[-
+>>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[-
+>+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[-
+>>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[-
+>+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[-
+>>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[-
+>+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<-
+>]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-
+]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-
+>-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-
+]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<-
+>]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-
+]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+>+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-
+>-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-
+]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+>+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<-
+>]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-
+]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+>+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-
+>-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-
+]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[-
+>>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<-
+>]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-
+]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[-
+>>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-
+>-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-
+]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[-
+>>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<-
+>]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-
+]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>]<[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[-
+>>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-
+>-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-
+]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>]<[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[-
+>>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<-
+>]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-
+]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>]<[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-
+<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-
+<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>]<[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-
+<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-
+<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-
+]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>]<[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-
+<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-
+<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>]<[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-
+<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-
+<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-
+]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>]<[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-
+<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-
+<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>]<[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-
+]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-
+<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-
+]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>]<[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-
+]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-
+<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>]<[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-
+]>[-<+[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-
+<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-
+]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]
+<[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-
+<+[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[-
+>+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[
+-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[-
+>>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[-
+>+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[-
+>>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[-
+>+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[-
+>>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[-
+>+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[-
+>>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-
+>-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-
+]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>
+>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<-
+>]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-
+]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-
+>-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-
+]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-
+>+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<-
+>]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-
+]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-
+>+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-
+>-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-
+]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[->+<]>[-
+>>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<-
+>]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-
+]<+>>>>>[-]]<<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[->+<]>[-
+>>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-
+>-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-
+]<+>>>>[-]]<[-]<]<<<[-]>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[->+<]>[-
+>>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<-
+>]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-
+]<+>>>>>[-]]<<[-]<]<<<[-]>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[->+<]>[-
+>>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-
+>-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-
+]<+>>>>[-]]<[-]<]<<<[-]>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[->+<]>[-
+>>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<-
+>]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-
+]<+>>>>>[-]]<<[-]<]<<<[-]>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[->+<]>[-
+>>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-
+>-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-
+]<+>>>>[-]]<[-]<]<<<[-]>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-
+<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-
+<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-
+]>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<[-<<+>>]<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-
+<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-
+<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<[-<<+>>]<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>++<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-
+<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-
+<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-
+]>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<[-<<+>>]<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>++<<<<<<<<<<<<<<]>>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-
+<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-
+<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<[-<<+>>]<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>++<<<<<<<<<<<<<]>>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-
+<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-
+<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-
+]>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[-<<+>>]<<<<<<<<<<<<<[-
+>>>>>>>>>>>>++<<<<<<<<<<<<]>>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-
+]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-
+<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<[-<<+>>]<<<<<<<<<<<<[-
+>>>>>>>>>>>++<<<<<<<<<<<]>>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-
+]>[-<+[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-
+<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-
+]>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<[-<<+>>]<<<<<<<<<<<[-
+>>>>>>>>>>++<<<<<<<<<<]>>>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-
+]>[-<+[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-
+<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-
+<<<<<<<<<<<<+>>>>>>>>>>>>]<[-<<+>>]<<<<<<<<<<[->>>>>>>>>++<<<<<<<<<]>>>>>>>>[-
+>+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<-
+>]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-
+]<+>>>>>[-]]<<[-]<]<<<[-]>>[-<<<<<<<<<<<+>>>>>>>>>>>]<[-<<+>>]<<<<<<<<<[-
+>>>>>>>>++<<<<<<<<]>>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[-
+>+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-<<<<<<<<<<+>>>>>>>>>>]<[-
+<<+>>]<<<<<<<<[->>>>>>>++<<<<<<<]>>>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-
+]>[-]>[-<+[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-
+<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-
+]>>[-<<<<<<<<<+>>>>>>>>>]<[-<<+>>]<<<<<<<[->>>>>>++<<<<<<]>>>>>[->+<]>[-
+>>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-
+>-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-
+]<+>>>>[-]]<[-]<]<<<[-]>>[-<<<<<<<<+>>>>>>>>]<[-<<+>>]<<<<<<[-
+>>>>>++<<<<<]>>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[-
+>>+<+<]>[-<+>]>[<<<<[-]<+>>>>>[-]]<<[-]<]<<<[-]>>[-<<<<<<<+>>>>>>>]<[-
+<<+>>]<<<<<[->>>>++<<<<]>>>[->+<]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<[-]>[-]>[-<+[-
+>>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[-
+>+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<<[-]>>[-<<<<<<+>>>>>>]<[-<<+>>]<<[-
+]<<<[->>>>>+<+<<<<]>>>>[-<<<<+>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.------------------
+------------------------------>>>>>[-]]<<<<<<[->>>>>>+<+<<<<<]>>>>>[-
+<<<<<+>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-----------------
+------------------------------->>>>>>[-]]<<<<<<<[->>>>>>>+<+<<<<<<]>>>>>>[-
+<<<<<<+>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.----------------
+-------------------------------->>>>>>>[-]]<<<<<<<<[-
+>>>>>>>>+<+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.---------------
+--------------------------------->>>>>>>>[-]]<<<<<<<<<[-
+>>>>>>>>>+<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.--------------
+---------------------------------->>>>>>>>>[-]]<<<<<<<<<<[-
+>>>>>>>>>>+<+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-------------
+----------------------------------->>>>>>>>>>[-]]<<<<<<<<<<<[-
+>>>>>>>>>>>+<+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>[>[-]+<[-]]>[-
+<+<+>>]<<[->>+<<]>[<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-
+----------------------------------------------->>>>>>>>>>>[-]]<<<<<<<<<<<<[-
+>>>>>>>>>>>>+<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>[>[-]+<[-]]>[-
+<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-----------
+------------------------------------->>>>>>>>>>>>[-]]<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>+<+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>[-]+<[-
+]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.----------
+-------------------------------------->>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[>[-
+]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.---------
+--------------------------------------->>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.--------
+---------------------------------------->>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-------
+----------------------------------------->>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.------
+------------------------------------------>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-----
+------------------------------------------->>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.----
+-------------------------------------------->>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.---
+--------------------------------------------->>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.--
+---------------------------------------------->>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-
+----------------------------------------------->>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.
+------------------------------------------------>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++
+.------------------------------------------------>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++++++
++.------------------------------------------------>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++
+++.------------------------------------------------>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-
+<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++++
++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-
+<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++
+++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-
+]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++
++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-
+]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++
+++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-
+<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++
++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-
+<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++
+++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-
+]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++
++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-
+]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++
+++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-
+]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++
++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-
+]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++
+++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-
+]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++
++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[
+-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++
+++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[
+>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++
++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]
+>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++
+++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++
++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++
+++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++
++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++
+++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++
++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++
+++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++
++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++++
+++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++
++++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++++
+++++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++
++++++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++++
+++++++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++
++++++++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++++
+++++++++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++
++++++++++++++++++++++++++++++++.------------------------------------------------
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++
+++++++++++++++++++++++++++++++++.-----------------------------------------------
+->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++
++++++++++++++++++++++++++++++++++.----------------------------------------------
+-->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++
+++++++++++++++++++++++++++++++++++.---------------------------------------------
+--->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++
++++++++++++++++++++++++++++++++++++.--------------------------------------------
+---->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++
+++++++++++++++++++++++++++++++++++++.-------------------------------------------
+----->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++
++++++++++++++++++++++++++++++++++++++.------------------------------------------
+------>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++
+++++++++++++++++++++++++++++++++++++++.-----------------------------------------
+------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++
++++++++++++++++++++++++++++++++++++++++.----------------------------------------
+-------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++
+++++++++++++++++++++++++++++++++++++++++.---------------------------------------
+--------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++
++++++++++++++++++++++++++++++++++++++++++.--------------------------------------
+---------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++
+++++++++++++++++++++++++++++++++++++++++++.-------------------------------------
+----------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++
++++++++++++++++++++++++++++++++++++++++++++.------------------------------------
+------------>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-]]>[-]+[-<+<+>>]<<[-
+>>+<<]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++
+++++++++++++++++++++++++++++++++++++++++++++.-----------------------------------
+------------->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-]]>[-]++++++++++.[-]<<<<<-]
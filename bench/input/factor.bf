@@ -0,0 +1,47 @@
+Prints the prime factorization of every number from 2 to 250
+Each step does a full division by repeated subtraction
+
+++>------->+<[>>++++++++++<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<<<<<[-]>[-]>>>[-<<<+[->>>>>+>>+<<<<<<<]>>>>>>>[-
+<<<<<<<+>>>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[-
+>>+<+<]>[-<+>]>[<<<<<<[-]<+>>>>>>>[-]]<<[-]<]<<<<[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<[-]>[-]>[-<+[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<[-
+>>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-
+<<+>>]<[<<<[-]>>>[-]]<[-]<<[->+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<[-
+>>+>+<<<]>>>[-<<<+>>>]<[<<++++++++++++++++++++++++++++++++++++++++++++++++.-----
+------------------------------------------->>[-]]<<<<[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<[<++++++++++++++++++++++++++++++++++++++++++++++++.----------------
+-------------------------------->[-
+]]<<<++++++++++++++++++++++++++++++++++++++++++++++++.--------------------------
+----------------------<[-]>[-]>[-]>[-]<<<<[-
+]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<[-
+>>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]>>++<<<<[->+>>>>>+<<<<<<]>>>>>>[-
+<<<<<<+>>>>>>]<<<<<<<[->>>>>>+>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<[-<<<<-
+>>>>]<<<+<[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<[<<<<[-]>>>>[-]]<<<<<[-]>>+<[-
+>>>+<<<<+>]<[->+<]>>>>[<<[-]>>[-]]<<<[-]>[<<<[->+>>>>>+<<<<<<]>>>>>>[-
+<<<<<<+>>>>>>]<<<<[-]>>>[-]<<<<[->>>>+[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<<<<[-
+>>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-
+]]<<[-]<[->>+<+<]>[-<+>]>[<<<[-]<<<+>>>>>>[-]]<<[-]<<<<<]+>>>>[->+>>+<<<]>>>[-
+<<<+>>>]<<[<<<<<[-]>>>>>[-]]+<<<<<[->>>>>>>+<+<<<<<<]>>>>>>[-
+<<<<<<+>>>>>>]>[<<[-]>>[-]]<<<<<<<[->>>>>>>+<+<<<<<<]>>>>>>[-
+<<<<<<+>>>>>>]>[<++++++++++++++++++++++++++++++++.[-]++++++++++<<<[-
+>>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<[-]>[-]>>>[-<<<+[-
+>>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<[-
+>>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[-<->]<<+>[-
+>>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[->>+<+<]>[-<+>]>[<<<<<<[-
+]<+>>>>>>>[-]]<<[-]<]<<<<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<[-]>[-]>[-<+[-
+>>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>>>[-
+<<<<<<<<<<+>>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[-
+>+>+<<]>>[-<<+>>]<[<<<[-]<+>>>>[-]]<[-]<]<<[->>+>+<<<]>>>[-
+<<<+>>>]<[<<++++++++++++++++++++++++++++++++++++++++++++++++.-------------------
+----------------------------->>[-]]<<<<[->>>>+>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<[<++++++++++++++++++++++++++++++++++++++++++++++++.----------------
+-------------------------------->[-
+]]<<<++++++++++++++++++++++++++++++++++++++++++++++++.--------------------------
+----------------------<[-]>[-]>[-]>[-]<<<<<[-]<<<<<<<[-]>>[-<<+>>]>>>>>>[-]]<<[-
+>>+<+<]>[-<+>]>[<<<<+>>>>[-]]<<<<<<[-]>>>[-]<<<<[-]>>>>>[-]<<<[-]<<<[-
+>+>+<<]>>[-<<+>>]<<<[->>>>>>+<<<+<<<]>>>[-<<<+>>>]>>>[-<<<<->>>>]>+<<<<<[-
+>+>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<[>>>>[-]<<<<[-]]<[-]>>+>>>[-
+<+<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>[<<[-]>>[-]]>[-]<<<]>>>++++++++++.[-
+]<<<<<<[-]>>>>[-]<[-]<<<<<<+>-]
@@ -0,0 +1,26 @@
+Solves the towers of Hanoi for 16 disks printing each of the 65535 moves
+The disks are kept in frames on the tape so it also moves around a lot
+Most of the time goes into output
+
+>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]++++++++++++++++>[-]+>[-]+++>[-]++<<<<[>>>>>[->>
+>>>>+<+<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<+>>[<<[-]>>[-]]<<<<<[->>>>>>+<+<<<<<]>>>>>
+>[-<<<<<<+>>>>>>]<-<+>[<[-]>[-]]<<<<<[->>>>>>>+<+<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>
+]<--<+>[<[-]>[-]]<<<[<<<<<<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<
+<<<+>>>>>>>>>>>>]<+<[<<<<<<[-]+>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>
+>>>>>>>>>]>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>+>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<[->
+>>>>>>>>>+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>
+>>>>>]<<<<<<<+>>>>>>[-]<[-]]>[<<<<<+>>>>>[-]]<<<[-]<[-]]>[<<<<<<<[->>>>>>>>>>+<+
+<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<+++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++.[-]<<<<<<<<[->>>>>>>>>+<+<<<<<<<<]>>>>>>>>>[-<<<<<
+<<<<+>>>>>>>>>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+.[-]++++++++++.[-]<<<<<<[-]++>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<[->>>
+>>>>>>>+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>
+>]>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<[->>>>>>>+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<[->>>>>>>>+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<<<[->>>>>>>>>+>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<+>>>[-]]>[<<<+>>>
+[-]]<<<<[->>>>>>>>>>>>>>>>>>>>>>>>]>[-<<<<<<<[-]>[-]>[-]>[-]>[-]>[-]>><<<<<<<<<<
+<<<<<<<<<<<<<<]<<<<<<<]
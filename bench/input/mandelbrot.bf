@@ -0,0 +1,81 @@
+Draws the Mandelbrot set as 41 by 37 characters of ASCII art
+Fixed point with a scale of 16 and up to 100 iterations for each point
+Nearly all of the time goes into the nested loops of the multiplies
+
+[-]------------------>[-]+++++++++++++++++++++++++++++++++++++[>[-]-------------
+------------------->[-]+++++++++++++++++++++++++++++++++++++++++[>[-]>[-]>[-]>[-
+]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++[->>>>>>>>>>>>>[-]+++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<<<[->>>+<+<<]>>>[-<<<+>>>]<[-<[-
+>>>>+<<+<<]>>>>[-<<<<+>>>>]<+<[<<->>>[-]<[-]]>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>[-]>
+>[-]]<<]<[-]<[-]+<<<<<<<<<<<[->>>>>>>>>>>>>+<+<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<+>>>>>>>>>>>>>]<[<[-]>[-]]<<<<<<<<<<<<[-]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>
+>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<+<<<<]>>>>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>>>>>>>>>>+<+<<<<<<<<<<<]>>>>>>>>>>
+>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<[<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<->>>>>>>>>>>>>]<[-]][-]+++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<<[->>>+<+<<]>>>[-<<<+>>>]<[-<[-
+>>>>+<<+<<]>>>>[-<<<<+>>>>]<+<[<<->>>[-]<[-]]>[<<<<<<<<<<<<<+>>>>>>>>>>>[-]>>[-]
+]<<]<[-]<[-]+<<<<<<<<<[->>>>>>>>>>>+<+<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>
+>>>>>]<[<[-]>[-]]<<<<<<<<<<[-]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>+<<<<<<<<<<+<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]
+<<<<<<<<<[->>>>>>>>>>+<+<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<
+[->>>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<->>>>>>>>>>>]<[-]]>>[-]+++++++
+++++++++++++++++++++++++++<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<[->>>+<+<<]>>>[-<<<+>>>
+]<[-<[->>>>+<<+<<]>>>>[-<<<<+>>>>]<+<[<<->>>[-]<[-]]>[<<<<<<+>>>>[-]>>[-]]<<]<[-
+]<[-][-]+++++++++++++++++++++++++++++++++<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<<+<<<<<<
+<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<[->>>+<+<<]>>>[-<<<+
+>>>]<[-<[->>>>+<<+<<]>>>>[-<<<<+>>>>]<+<[<<->>>[-]<[-]]>[<<<<<+>>>[-]>>[-]]<<]<[
+-]<[-]<<[>[<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<+<<<<<<<
+<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<[-<<+[->>>>>+<
++<<<<]>>>>>[-<<<<<+>>>>>]<----------------<+>[<[-]>[-]]<[<<<[-]<<<<<<<<<<+>>>>>>
+>>>>>>>[-]]<]<]<[-]<<<<<<<<<<<<[->>>>>>>>>>>>>>+<+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<
+]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<[-<<+[->>>>>+<+<<<<]>>>>>[-<<
+<<<+>>>>>]<----------------<+>[<[-]>[-]]<[<<<[-]<<<<<<<<<+>>>>>>>>>>>>[-]]<]<]<[
+-]<<<<<<<<<<[->>>>>>>>>>>+<+<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<
+<<<<<<[->>>>>>>>>>+<+<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>][-]++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++<[->>>>+<<+<<]>>>>[-<<<<+>>
+>>]<<<[->>>+<+<<]>>>[-<<<+>>>]<[-<[->>>>+<<+<<]>>>>[-<<<<+>>>>]<+<[<<->>>[-]<[-]
+]>[<<<<<<<<<<<<+>>>>>>>>>>[-]>>[-]]<<]<[-]<[-]<[-]<[-]]<[-]]>[-]<<<<<<[->>>>>>>+
+<<+<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<+<[<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<+<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<
+[-<<+[->>>>>+<+<<<<]>>>>>[-<<<<<+>>>>>]<----------------<+>[<[-]>[-]]<[<<<[-]<<<
+<<<<<+>>>>>>>>>>>[-]]<]<]<[-]<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<+<<<<<<<<<<<<<]>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+<+<<<<<<<<<<
+<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<[->>>+<+<<]>>>[-<<<+>>>]<-<+>[<[-]>[-
+]]<<[-]<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[->>+<<<+>]>>[-<<+>>]<+<<[<<<<<<<<[
+-<<<<<<<<<-->>>>>>>>>]>>>>>>>>>>[-]<<[-]]>>[<<<<<<<<<<[-<<<<<<<<<++>>>>>>>>>]>>>
+>>>>>>>[-]]<<<<<<<<<<[-]>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<+<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[-]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<<<<<<<<-
+>>>>>>>>>]<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<+<<]>>>>>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>[-]<[-]]>[<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<[-]>[-]>[-]>[-]>[-]>
+[-]>>[-]<<<<<<<<]<[->>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>]<----------------------------------------------------
+------------------------------------------------<+>[<[-]>[-]]<[->>>+<<+<]>>>[-<<
+<+>>>]<+<[>>+++++++++++++++++++++++++++++++++++.[-]<[-]<[-]]>[>>[-]+++<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]<<<[->>>+<+<<]>>>[-<<<+>>>]<[-<[->>>>+
+<<+<<]>>>>[-<<<<+>>>>]<+<[<<->>>[-]<[-]]>[<<<<<+>>>[-]>>[-]]<<]<[-]<[-]<[->>>+<<
++<]>>>[-<<<+>>>]<+<[>>++++++++++++++++++++++++++++++++.[-]<[-]<[-]]>[>>[-]++++++
+<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<<<[->>>+<
++<<]>>>[-<<<+>>>]<[-<[->>>>+<<+<<]>>>>[-<<<<+>>>>]<+<[<<->>>[-]<[-]]>[<<<<<+>>>[
+-]>>[-]]<<]<[-]<[-]<[->>>+<<+<]>>>[-<<<+>>>]<+<[>>++++++++++++++++++++++++++++++
+++++++++++++++++.[-]<[-]<[-]]>[>>[-]++++++++++++<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<[->>>+<+<<]>>>[-<<<+>
+>>]<[-<[->>>>+<<+<<]>>>>[-<<<<+>>>>]<+<[<<->>>[-]<[-]]>[<<<<<+>>>[-]>>[-]]<<]<[-
+]<[-]<[->>>+<<+<]>>>[-<<<+>>>]<+<[>>++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++.[-]<[-]<[-]]>[>+++++++++++++++++++++++++++++++++++++++++++.[-]<[-
+]]<<[-]<[-]]<<[-]<[-]]<<[-]<[-]]<<[-]<<<<<<<<<<<<<<<<<<+>-]>>>>>>>>>>>>>>>>>++++
+++++++.[-]<<<<<<<<<<<<<<<<<<<<+>-]
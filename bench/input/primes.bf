@@ -0,0 +1,32 @@
+Prints the primes below 121 using trial division by every smaller number
+Generated with simple copy and compare macros so it spends most of its time in
+small balanced loops
+
+++>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++[>+>++[->>>+>>+<<<<<]>>>>>[-
+<<<<<+>>>>>]<<<<<<<<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[-<-
+>]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<<+>[->>+<+<]>[-<+>]>[<<<[-
+]>>>[-]]<<[-]<[<<<<[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<[-]>>[-
+]<[->+[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<<<<<<<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-
+<<<<<<<<+>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[-
+>>+<+<]>[-<+>]>[<<<[-]<<+>>>>>[-]]<<[-]<<]+>[->+>>+<<<]>>>[-<<<+>>>]<<[<<[-]>>[-
+]]<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<[<<<<<<[-]>>>>>>[-]]<<[-]<[-]>>[-]<<<<+>[-
+]<[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-
+<<<<<<<<+>>>>>>>>]<<[-<->]>+<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[<[-]>[-
+]]<<<[-]<+>>>[-<+<+>>]<<[->>+<<]>[<<[-]>>[-]]>[-]<<<]<<[->>>>>+<+<<<<]>>>>[-
+<<<<+>>>>]>[<++++++++++<<<<<<[->>>>>>>>>>>+>+<<<<<<<<<<<<]>>>>>>>>>>>>[-
+<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<[-]>>>[-]>>>[-<<<+[->>>>>+>>+<<<<<<<]>>>>>>>[-
+<<<<<<<+>>>>>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<[-<->]<<+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<[-]<[-
+>>+<+<]>[-<+>]>[<<<<<<[-]<<<+>>>>>>>>>[-]]<<[-]<]<<<<<<[-
+>>>>>>+>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[-]<[-]>>[-<<+[-
+>>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-
+<<<<<<<<<+>>>>>>>>>]<<[->-<]<+>>[->+>+<<]>>[-<<+>>]<[<<<[-]>>>[-]]<[-]<<[-
+>+>+<<]>>[-<<+>>]<[<<<<[-]>+>>>[-]]<[-]<]<[->+>+<<]>>[-
+<<+>>]<[<++++++++++++++++++++++++++++++++++++++++++++++++.----------------------
+-------------------------->[-]]<<<<<<[->>>>>>+>+<<<<<<<]>>>>>>>[-
+<<<<<<<+>>>>>>>]<[<<++++++++++++++++++++++++++++++++++++++++++++++++.-----------
+------------------------------------->>[-
+]]<<<++++++++++++++++++++++++++++++++++++++++++++++++.--------------------------
+----------------------<<<[-]>>>[-]>>[-]<[-]<<<[-
+]++++++++++++++++++++++++++++++++.[-]>[-]]<<<<<[-]>[-]<<<+>-]>>>++++++++++.[-]
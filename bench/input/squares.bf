@@ -0,0 +1,6 @@
+Prints the squares from 0 to 10000
+By Daniel B Cristofani
+
+++++[>+++++<-]>[<+++++>-]+<+[>[>+>+<<-]++>>[<<+>>-]>>>[-]++>[-]+>>>+[[-]++++++>>
+>]<<<[[<++++++++<++>>-]+<.<[>----<-]<]<<[>>>>>[>>>[-]+++++++++<[>-<-]+++++++++>[
+-[<->-]+[<<<]]<[>+<-]>]<<-]<<-]
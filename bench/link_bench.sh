@@ -0,0 +1,34 @@
+#!/bin/bash
+
+#   ------------------------------------------------------------
+#    link_bench.sh
+#
+#    Splits brainc's end to end latency on each test program
+#    into compiling and linking, by timing -c against a full
+#    build. Each is the best of 5 runs.
+#   ------------------------------------------------------------
+
+
+# Get the root directory and set all the appropriate directories from there.
+ROOT_DIR="$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && cd ../ && pwd )"
+
+BRAINC="$ROOT_DIR/bin/brainc"
+TEMP="$ROOT_DIR/bench/temp.$$"
+
+test ! -f $BRAINC && exit 1
+
+# Timing helpers, see common.sh.
+. "$ROOT_DIR/bench/common.sh"
+
+printf "%-16s %12s %12s %12s\n" "program" "compile ms" "total ms" "link ms"
+
+for INPUT in "$ROOT_DIR"/test/input/*.bf; do
+    NAME=$(basename $INPUT .bf)
+
+    COMPILE=$(best $BRAINC $INPUT -c -o $TEMP)
+    TOTAL=$(best $BRAINC $INPUT -o $TEMP)
+
+    printf "%-16s %12s %12s %12s\n" $NAME $COMPILE $TOTAL $((TOTAL - COMPILE))
+done
+
+rm -f $TEMP
@@ -0,0 +1,46 @@
+#!/bin/bash
+
+#   ------------------------------------------------------------
+#    outline_bench.sh
+#
+#    Times building ever bigger generated programs, with main
+#    holding everything, against --outline on one thread and on
+#    every core. The programs are copies of give-you-up after a
+#    read, so none of it can be folded away at compile time.
+#    Set SIZES to the copies wanted, each is ~19KB.
+#   ------------------------------------------------------------
+
+
+# Get the root directory and set all the appropriate directories from there.
+ROOT_DIR="$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && cd ../ && pwd )"
+
+BRAINC="$ROOT_DIR/bin/brainc"
+TEMP="$ROOT_DIR/bench/temp.$$"
+
+test ! -f $BRAINC && exit 1
+
+# Without outlining the time grows quadratically, so past this many bytes it's left out.
+WHOLE_LIMIT=${WHOLE_LIMIT:-200000}
+
+# Time a command in milliseconds.
+ms() {
+    local s=$(date +%s%N)
+    "$@" > /dev/null 2>&1
+    echo $(( ($(date +%s%N) - s) / 1000000 ))
+}
+
+printf "%-10s %12s %14s %14s %14s\n" "copies" "bytes" "main ms" "outline ms" "outline -j ms"
+
+for N in ${SIZES:-1 4 16 64 128}; do
+    (printf ','; for i in $(seq $N); do cat "$ROOT_DIR/test/input/give-you-up.bf"; done) > $TEMP.bf
+    BYTES=$(stat -c %s $TEMP.bf)
+
+    WHOLE=-
+    test $BYTES -le $WHOLE_LIMIT && WHOLE=$(ms $BRAINC $TEMP.bf --native -o $TEMP)
+    ONE=$(ms $BRAINC $TEMP.bf --native --outline --threads=1 -o $TEMP)
+    ALL=$(ms $BRAINC $TEMP.bf --native --outline -o $TEMP)
+
+    printf "%-10s %12s %14s %14s %14s\n" $N $BYTES $WHOLE $ONE $ALL
+done
+
+rm -f $TEMP $TEMP.bf
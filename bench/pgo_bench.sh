@@ -0,0 +1,39 @@
+#!/bin/bash
+
+#   ------------------------------------------------------------
+#    pgo_bench.sh
+#
+#    Measures what --profile-use buys over the static pipeline.
+#    Each benchmark program is built with --profile and run to
+#    record a profile, then rebuilt with and without it.
+#   ------------------------------------------------------------
+
+
+# Get the root directory and set all the appropriate directories from there.
+ROOT_DIR="$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && cd ../ && pwd )"
+
+BRAINC="$ROOT_DIR/bin/brainc"
+TEMP="$ROOT_DIR/bench/temp.$$"
+OPT=${1:--O2}
+
+test ! -f $BRAINC && exit 1
+
+# Timing helpers, see common.sh.
+. "$ROOT_DIR/bench/common.sh"
+
+printf "%-16s %12s %12s\n" "program" "static ms" "pgo ms"
+
+for INPUT in "$ROOT_DIR"/bench/input/*.bf; do
+    NAME=$(basename $INPUT .bf)
+    STDIN=$ROOT_DIR/bench/stdin/$NAME.in
+    test -f $STDIN || STDIN=/dev/null
+
+    # Record a profile, then build with and without it.
+    $BRAINC $OPT --native --profile $INPUT -o $TEMP && BF_PROFILE_FILE=$TEMP.prof $TEMP < $STDIN > /dev/null
+    $BRAINC $OPT --native $INPUT -o $TEMP.static
+    $BRAINC $OPT --native --profile-use=$TEMP.prof $INPUT -o $TEMP.pgo
+
+    printf "%-16s %12s %12s\n" $NAME $(BEST_INPUT=$STDIN best $TEMP.static) $(BEST_INPUT=$STDIN best $TEMP.pgo)
+done
+
+rm -f $TEMP $TEMP.prof $TEMP.static $TEMP.pgo
@@ -0,0 +1,463 @@
+// ------------------------------------------------------------
+//  scale.cpp
+//
+//  Entry point for brainscale, the compile time scalability
+//  suite. Generates programs with bfgen that grow along one
+//  dimension at a time, size, nesting depth, loop count or
+//  size with comments, and compiles each with brainc --stats.
+//  The time and peak memory of every phase are fitted against
+//  the dimension on a log-log scale, and any phase growing
+//  faster than linearly is flagged, as is a compile that
+//  crashes or times out partway up a series.
+// ------------------------------------------------------------
+
+// Include statments.
+#include <map>
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+
+// One program in a series, and what compiling it cost. x is the dimension the series grows along.
+struct point {
+    uint64_t x = 0, bytes = 0;
+    int status = 0;
+    double wall_ms = 0;
+    long rss_kb = 0;
+    std::vector<std::string> phases;
+    std::map<std::string, double> phase_ms;
+    std::map<std::string, long> phase_rss_kb;
+};
+
+// A phase only counts towards the fit at the points where it takes at least this long, or has grown the memory
+// by at least this much over the smallest program. Below these it's all startup and noise.
+static const double TIME_FLOOR_MS = 20;
+static const long RSS_FLOOR_KB = 16 << 10;
+
+static const std::string USAGE = "\x1B[33mUsage:\033[0m brainscale [-h] [--series=<series>] [--min-size=<bytes>] [--max-size=<bytes>] [--max-depth=<n>] [--max-loops=<n>] [--step=<n>] [--max-slope=<n>] [--timeout=<s>] [--flags=<flags>] [--json=<file>]\n";
+
+static const std::string OPTIONS = "Options:\n"
+                                   "  -h, --help           Display this information.\n"
+                                   "  --series=<series>    Comma separated series, out of size, depth, loops and comments. All by default.\n"
+                                   "  --min-size=<bytes>   Smallest program in the size and comments series. 1K is default.\n"
+                                   "  --max-size=<bytes>   Largest program in the size and comments series, up to 1G. 64M is default.\n"
+                                   "  --max-depth=<n>      Deepest nesting in the depth series, from 1K up. 1M is default.\n"
+                                   "  --max-loops=<n>      Most loops in the loops series, from 1K up, in a 16M program. 1M is default.\n"
+                                   "  --step=<n>           Grow each series by this factor from one program to the next. 4 is default.\n"
+                                   "  --max-slope=<n>      Flag phases whose time or memory grows faster than x^n. 1.3 is default.\n"
+                                   "  --timeout=<s>        Kill a compile taking longer than this, ending it's series. 600 is default.\n"
+                                   "  --flags=<flags>      Space separated flags for brainc. \"-c --native -O1\" is default.\n"
+                                   "  --json=<file>        Where the results go. scale.json is default.\n";
+
+
+// ------------------------------------------------------------
+//  split
+//
+//  Split a list on the given separator.
+// ------------------------------------------------------------
+static std::vector<std::string> split(const std::string& list, char sep) {
+
+    std::vector<std::string> items;
+    std::stringstream ss(list);
+
+    for (std::string item; std::getline(ss, item, sep);) {
+        if (!item.empty()) items.push_back(item);
+    }
+
+    return items;
+}
+
+
+// ------------------------------------------------------------
+//  parse_size
+//
+//  A number with an optional K, M or G suffix.
+// ------------------------------------------------------------
+static uint64_t parse_size(const std::string& s) {
+
+    char* end;
+    uint64_t n = strtoull(s.c_str(), &end, 10);
+
+    switch (*end) {
+        case 'G': case 'g': n <<= 10; [[fallthrough]];
+        case 'M': case 'm': n <<= 10; [[fallthrough]];
+        case 'K': case 'k': n <<= 10;
+    }
+
+    return n;
+}
+
+
+// ------------------------------------------------------------
+//  human
+//
+//  A count with the biggest suffix that divides it evenly.
+// ------------------------------------------------------------
+static std::string human(uint64_t n) {
+
+    const char* suffixes[] = {"", "K", "M", "G"};
+    int i = 0;
+
+    while (i < 3 && n >= 1024 && n % 1024 == 0) n /= 1024, i++;
+
+    return std::to_string(n) + suffixes[i];
+}
+
+
+// ------------------------------------------------------------
+//  execute
+//
+//  Run a command with it's output thrown away, filling in the
+//  wall time and the peak resident memory of the command. The
+//  exit status is returned, or 128 plus the signal that killed
+//  it. The alarm survives the exec, so a command that runs
+//  too long is killed by SIGALRM.
+// ------------------------------------------------------------
+static int execute(const std::vector<std::string>& args, unsigned timeout, double& ms, long& rss_kb) {
+
+    std::vector<char*> argv;
+    for (const std::string& arg : args) argv.push_back((char*) arg.c_str());
+    argv.push_back(nullptr);
+
+    auto start = std::chrono::steady_clock::now();
+    pid_t pid = fork();
+
+    if (pid == 0) {
+        int null_fd = open("/dev/null", O_RDWR);
+        dup2(null_fd, STDIN_FILENO);
+        dup2(null_fd, STDOUT_FILENO);
+        dup2(null_fd, STDERR_FILENO);
+
+        alarm(timeout);
+        execv(argv[0], argv.data());
+        _exit(127);
+    }
+
+    if (pid < 0) return -1;
+
+    int status = 0;
+    rusage usage{};
+    wait4(pid, &status, 0, &usage);
+
+    ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    rss_kb = usage.ru_maxrss;
+
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+}
+
+
+// ------------------------------------------------------------
+//  read_phases
+//
+//  Read back the phases from brainc's --stats-json, which
+//  puts one to a line. Phases that run more than once, like
+//  the cache, are added up.
+// ------------------------------------------------------------
+static void read_phases(const std::string& path, point& p) {
+
+    std::ifstream ifs(path);
+
+    // The value of a field in the line, without the quotes for a string.
+    auto field = [](const std::string& line, const std::string& name) {
+        size_t at = line.find("\"" + name + "\": ");
+        if (at == std::string::npos) return std::string();
+
+        at += name.size() + 4;
+        std::string value = line.substr(at, line.find_first_of(",}", at) - at);
+
+        if (value.size() >= 2 && value.front() == '"') value = value.substr(1, value.size() - 2);
+        return value;
+    };
+
+    for (std::string line; std::getline(ifs, line);) {
+        if (line.find("\"wall_ms\"") == std::string::npos) continue;
+
+        std::string name = field(line, "name");
+        if (!p.phase_ms.count(name)) p.phases.push_back(name);
+
+        p.phase_ms[name] += atof(field(line, "wall_ms").c_str());
+        p.phase_rss_kb[name] = std::max(p.phase_rss_kb[name], atol(field(line, "peak_rss_kb").c_str()));
+    }
+}
+
+
+// ------------------------------------------------------------
+//  slope
+//
+//  Least squares fit of log(y) against log(x), which is the
+//  exponent of y's growth. Points where y is below the floor
+//  are left out, and with fewer than three left there's too
+//  little to go on, which is returned as NAN.
+// ------------------------------------------------------------
+static double slope(const std::vector<std::pair<double, double> >& xy, double floor) {
+
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    int n = 0;
+
+    for (const auto& [x, y] : xy) {
+        if (y < floor) continue;
+
+        double lx = std::log(x), ly = std::log(y);
+        sx += lx, sy += ly, sxx += lx * lx, sxy += lx * ly;
+        n++;
+    }
+
+    if (n < 3 || n * sxx - sx * sx <= 0) return NAN;
+
+    return (n * sxy - sx * sy) / (n * sxx - sx * sx);
+}
+
+
+// ------------------------------------------------------------
+//  generate
+//
+//  Write out the series' program for x with bfgen.
+// ------------------------------------------------------------
+static bool generate(const std::filesystem::path& bin, const std::string& series, uint64_t x, const std::string& file,
+                     unsigned timeout) {
+
+    std::vector<std::string> cmd = {(bin / "bfgen").string(), "-o", file};
+
+    // Depths cost 3 bytes a level, and get a little code around them. Loops share a fixed size program.
+    if (series == "size") cmd.push_back("--size=" + std::to_string(x));
+    else if (series == "comments") cmd.push_back("--size=" + std::to_string(x)), cmd.push_back("--comments=75");
+    else if (series == "depth") cmd.push_back("--size=" + std::to_string(3 * x + 4096)), cmd.push_back("--depth=" + std::to_string(x));
+    else cmd.push_back("--size=16M"), cmd.push_back("--loops=" + std::to_string(x));
+
+    double ms;
+    long rss_kb;
+
+    return execute(cmd, timeout, ms, rss_kb) == 0;
+}
+
+
+// ------------------------------------------------------------
+//  run_series
+//
+//  Compile the series' programs from smallest to largest,
+//  stopping at the first that fails, since the larger ones
+//  will too. Each failure is added to problems.
+// ------------------------------------------------------------
+static std::vector<point> run_series(const std::filesystem::path& bin, const std::filesystem::path& temp, const std::string& series,
+                                     const std::vector<uint64_t>& xs, const std::vector<std::string>& flags, unsigned timeout,
+                                     std::vector<std::string>& problems) {
+
+    std::vector<point> points;
+    std::string source = (temp / (series + ".bf")).string();
+    std::string stats = (temp / (series + ".json")).string();
+
+    printf("\n%s\n%-8s %12s %12s %12s  %s\n", series.c_str(), "x", "bytes", "wall ms", "rss KiB", "phases (ms/KiB)");
+
+    for (uint64_t x : xs) {
+        point p;
+        p.x = x;
+
+        if (!generate(bin, series, x, source, timeout)) {
+            problems.push_back(series + " " + human(x) + ": bfgen failed");
+            break;
+        }
+
+        std::error_code ec;
+        p.bytes = std::filesystem::file_size(source, ec);
+
+        std::vector<std::string> cmd = {(bin / "brainc").string(), source, "-o", (temp / (series + ".out")).string(), "--stats-json=" + stats};
+        cmd.insert(cmd.end(), flags.begin(), flags.end());
+
+        std::filesystem::remove(stats, ec);
+        p.status = execute(cmd, timeout, p.wall_ms, p.rss_kb);
+        read_phases(stats, p);
+
+        printf("%-8s %12llu %12.1f %12ld ", human(x).c_str(), (unsigned long long) p.bytes, p.wall_ms, p.rss_kb);
+        for (const std::string& name : p.phases) printf(" %s=%.1f/%ld", name.c_str(), p.phase_ms[name], p.phase_rss_kb[name]);
+        printf("\n");
+        fflush(stdout);
+
+        points.push_back(p);
+
+        if (p.status != 0) {
+            std::string why = p.status == 128 + SIGALRM ? "timed out after " + std::to_string(timeout) + "s"
+                              : p.status > 128 ? "killed by signal " + std::to_string(p.status - 128)
+                              : "exited with status " + std::to_string(p.status);
+
+            problems.push_back(series + " " + human(x) + ": brainc " + why);
+            break;
+        }
+    }
+
+    return points;
+}
+
+
+// ------------------------------------------------------------
+//  check_growth
+//
+//  Fit every phase's time and memory against x, and the whole
+//  compile's, adding any that grow faster than max_slope to
+//  problems. Memory is measured from where the smallest
+//  program left it, so the fixed cost of LLVM doesn't hide
+//  the growth.
+// ------------------------------------------------------------
+static void check_growth(const std::string& series, const std::vector<point>& points, double max_slope, std::vector<std::string>& problems) {
+
+    std::vector<std::string> phases;
+
+    for (const point& p : points) {
+        for (const std::string& name : p.phases) {
+            if (std::find(phases.begin(), phases.end(), name) == phases.end()) phases.push_back(name);
+        }
+    }
+
+    phases.push_back("total");
+
+    for (const std::string& name : phases) {
+        std::vector<std::pair<double, double> > time, rss;
+        long base_rss = -1;
+
+        for (const point& p : points) {
+            if (p.status != 0) continue;
+
+            bool total = name == "total";
+            if (!total && !p.phase_ms.count(name)) continue;
+
+            long kb = total ? p.rss_kb : p.phase_rss_kb.at(name);
+            if (base_rss < 0) base_rss = kb;
+
+            time.push_back({(double) p.x, total ? p.wall_ms : p.phase_ms.at(name)});
+            rss.push_back({(double) p.x, (double) (kb - base_rss)});
+        }
+
+        double time_slope = slope(time, TIME_FLOOR_MS), rss_slope = slope(rss, RSS_FLOOR_KB);
+
+        auto shown = [](double s) {
+            char buf[32];
+            snprintf(buf, sizeof(buf), "%.2f", s);
+            return std::isnan(s) ? std::string("-") : std::string(buf);
+        };
+
+        printf("  %-10s time ~ x^%-6s memory ~ x^%s\n", name.c_str(), shown(time_slope).c_str(), shown(rss_slope).c_str());
+
+        if (time_slope > max_slope) problems.push_back(series + " " + name + ": time grows as x^" + shown(time_slope));
+        if (rss_slope > max_slope) problems.push_back(series + " " + name + ": memory grows as x^" + shown(rss_slope));
+    }
+}
+
+
+// ------------------------------------------------------------
+//  write_json
+//
+//  One point to a line, with it's phases as fields.
+// ------------------------------------------------------------
+static bool write_json(const std::string& path, const std::map<std::string, std::vector<point> >& results) {
+
+    std::ofstream ofs(path);
+    if (!ofs) return false;
+
+    ofs << "{\n  \"points\": [\n";
+    bool first = true;
+
+    for (const auto& [series, points] : results) {
+        for (const point& p : points) {
+            ofs << (first ? "" : ",\n") << "    {\"series\": \"" << series << "\", \"x\": " << p.x << ", \"bytes\": " << p.bytes
+                << ", \"status\": " << p.status << ", \"wall_ms\": " << p.wall_ms << ", \"rss_kb\": " << p.rss_kb;
+
+            for (const std::string& name : p.phases) {
+                ofs << ", \"" << name << "_ms\": " << p.phase_ms.at(name) << ", \"" << name << "_rss_kb\": " << p.phase_rss_kb.at(name);
+            }
+
+            ofs << "}";
+            first = false;
+        }
+    }
+
+    ofs << "\n  ]\n}\n";
+    return (bool) ofs;
+}
+
+
+int main(int argc, char** argv) {
+
+    // bfgen and brainc live next to us in bin.
+    std::error_code ec;
+    std::filesystem::path bin = std::filesystem::read_symlink("/proc/self/exe", ec).parent_path();
+
+    uint64_t min_size = 1 << 10, max_size = 64 << 20, max_depth = 1 << 20, max_loops = 1 << 20, step = 4;
+    double max_slope = 1.3;
+    unsigned timeout = 600;
+    std::string json = "scale.json";
+    std::vector<std::string> series = {"size", "depth", "loops", "comments"}, flags = {"-c", "--native", "-O1"};
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "-h" || arg == "--help") {
+            std::cout << USAGE << OPTIONS;
+            return 0;
+        }
+
+        if (arg.rfind("--series=", 0) == 0) series = split(value, ',');
+        else if (arg.rfind("--min-size=", 0) == 0) min_size = std::max<uint64_t>(parse_size(value), 1);
+        else if (arg.rfind("--max-size=", 0) == 0) max_size = parse_size(value);
+        else if (arg.rfind("--max-depth=", 0) == 0) max_depth = parse_size(value);
+        else if (arg.rfind("--max-loops=", 0) == 0) max_loops = parse_size(value);
+        else if (arg.rfind("--step=", 0) == 0) step = std::max<uint64_t>(parse_size(value), 2);
+        else if (arg.rfind("--max-slope=", 0) == 0) max_slope = atof(value.c_str());
+        else if (arg.rfind("--timeout=", 0) == 0) timeout = atoi(value.c_str());
+        else if (arg.rfind("--flags=", 0) == 0) flags = split(value, ' ');
+        else if (arg.rfind("--json=", 0) == 0) json = value;
+        else {
+            std::cerr << "\x1B[31merror:\033[0m unknown option " << arg << "\n" << USAGE;
+            return 2;
+        }
+    }
+
+    // Programs go to a directory of our own, removed at the end.
+    std::filesystem::path temp = std::filesystem::temp_directory_path() / ("brainscale." + std::to_string(getpid()));
+    std::filesystem::create_directories(temp);
+
+    std::map<std::string, std::vector<point> > results;
+    std::vector<std::string> problems;
+
+    for (const std::string& s : series) {
+        uint64_t first = s == "size" || s == "comments" ? min_size : 1 << 10;
+        uint64_t last = s == "size" || s == "comments" ? max_size : s == "depth" ? max_depth : max_loops;
+
+        if (s != "size" && s != "depth" && s != "loops" && s != "comments") {
+            std::cerr << "\x1B[31merror:\033[0m unknown series " << s << "\n" << USAGE;
+            return 2;
+        }
+
+        std::vector<uint64_t> xs;
+        for (uint64_t x = first; x <= last; x *= step) xs.push_back(x);
+
+        results[s] = run_series(bin, temp, s, xs, flags, timeout, problems);
+        check_growth(s, results[s], max_slope, problems);
+    }
+
+    std::filesystem::remove_all(temp, ec);
+
+    if (!write_json(json, results)) {
+        std::cerr << "\x1B[31merror:\033[0m can't write " << json << "\n";
+        return 2;
+    }
+
+    for (const std::string& line : problems) printf("SCALING %s\n", line.c_str());
+
+    return problems.empty() ? 0 : 1;
+}
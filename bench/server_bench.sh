@@ -0,0 +1,46 @@
+#!/bin/bash
+
+#   ------------------------------------------------------------
+#    server_bench.sh
+#
+#    Compares brainc's latency on each test program when run
+#    cold, against a warm compile server through brainc-client
+#    and brainc --client, both for -c and a full build. Each is
+#    the best of 5 runs.
+#   ------------------------------------------------------------
+
+
+# Get the root directory and set all the appropriate directories from there.
+ROOT_DIR="$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && cd ../ && pwd )"
+
+BRAINC="$ROOT_DIR/bin/brainc"
+CLIENT="$ROOT_DIR/bin/brainc-client"
+TEMP="$ROOT_DIR/bench/temp.$$"
+SOCKET="$ROOT_DIR/bench/temp.$$.sock"
+
+test ! -f $BRAINC && exit 1
+
+# Timing helpers, see common.sh.
+. "$ROOT_DIR/bench/common.sh"
+
+# Start the server, and wait for it's socket to show up.
+$BRAINC --serve --socket=$SOCKET > /dev/null 2>&1 &
+SERVER=$!
+trap "kill $SERVER 2> /dev/null; rm -f $TEMP" EXIT
+
+for i in $(seq 50); do test -S $SOCKET && break; sleep 0.1; done
+
+printf "%-16s %12s %12s %12s %12s %12s %12s\n" "program" "cold -c ms" "client -c" "--client -c" "cold ms" "client ms" "--client ms"
+
+for INPUT in "$ROOT_DIR"/test/input/*.bf; do
+    NAME=$(basename $INPUT .bf)
+
+    COLD_C=$(best $BRAINC $INPUT -c -o $TEMP)
+    THIN_C=$(best $CLIENT --socket=$SOCKET $INPUT -c -o $TEMP)
+    WARM_C=$(best $BRAINC --client --socket=$SOCKET $INPUT -c -o $TEMP)
+    COLD=$(best $BRAINC $INPUT -o $TEMP)
+    THIN=$(best $CLIENT --socket=$SOCKET $INPUT -o $TEMP)
+    WARM=$(best $BRAINC --client --socket=$SOCKET $INPUT -o $TEMP)
+
+    printf "%-16s %12s %12s %12s %12s %12s %12s\n" $NAME $COLD_C $THIN_C $WARM_C $COLD $THIN $WARM
+done
@@ -0,0 +1,40 @@
+#!/bin/bash
+
+#   ------------------------------------------------------------
+#    vm_bench.sh
+#
+#    Compares brainvm against the compiled output of brainc on
+#    the test programs and the larger benchmark programs. For
+#    brainc both the compile time and the run time are shown.
+#   ------------------------------------------------------------
+
+
+# Get the root directory and set all the appropriate directories from there.
+ROOT_DIR="$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && cd ../ && pwd )"
+
+BRAINC="$ROOT_DIR/bin/brainc"
+BRAINVM="$ROOT_DIR/bin/brainvm"
+TEMP="$ROOT_DIR/bench/temp.$$"
+
+test ! -f $BRAINC -o ! -f $BRAINVM && exit 1
+
+# Time a command in seconds, discarding its output.
+TIMEFORMAT=%R
+elapsed() { { time "$@" > /dev/null 2>&1; } 2>&1; }
+
+printf "%-16s %12s %12s %12s %12s\n" "program" "brainc" "compiled" "brainvm" "brainvm -O0"
+
+for INPUT in "$ROOT_DIR"/test/input/*.bf "$ROOT_DIR"/bench/input/*.bf; do
+    NAME=$(basename $INPUT .bf)
+    STDIN=$(dirname $INPUT)/../stdin/$NAME.in
+    test -f $STDIN || STDIN=/dev/null
+
+    COMPILE=$(elapsed $BRAINC $INPUT -o $TEMP)
+    NATIVE=$(elapsed $TEMP < $STDIN)
+    VM=$(elapsed $BRAINVM $INPUT < $STDIN)
+    VM_O0=$(elapsed $BRAINVM -O0 $INPUT < $STDIN)
+
+    printf "%-16s %12s %12s %12s %12s\n" $NAME $COMPILE $NATIVE $VM $VM_O0
+done
+
+rm -f $TEMP
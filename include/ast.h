@@ -11,6 +11,7 @@
 #include <memory>
 #include <utility>
 #include <vector>
+#include <cstdint>
 
 #include "util.h"
 
@@ -26,6 +27,12 @@ struct ast : public std::enable_shared_from_this<ast> {
     // Also the index into the program string, when needed.
     size_t line = 0, chr = 0, idx = 0;
 
+    // Operand and cell offset of the folded tokens, e.g. the amount to add or move by.
+    int64_t val = 0, off = 0;
+
+    // Structurally identical loops, relative to the head, share a shape once the bf optimizer has run, or 0 before.
+    size_t shape = 0;
+
     // Constructors and deconstructors.
     ast() = default;
     ast(brain::token t): token(t) {};
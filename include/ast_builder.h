@@ -46,9 +46,6 @@ private:
     void visit_multi(std::shared_ptr<ast>& t);
     void visit_single(std::shared_ptr<ast>& t);
 
-    // Helper function for getting the index of the closing bracket in a loop.
-    size_t loop_lookahead(size_t start);
-
     // Helper function for incrementing the index, respecting char and line position.
     void incr_idx(size_t& idx, size_t& line, size_t& chr);
 
@@ -0,0 +1,32 @@
+// ------------------------------------------------------------
+//  batch.h
+//
+//  Helpers for compiling many files in one process.
+// ------------------------------------------------------------
+
+#pragma once
+
+
+// Include statements.
+#include <string>
+#include <vector>
+#include <functional>
+
+
+namespace brain {
+
+    // Run job(0) through job(n - 1) on a pool of worker threads, each taking the next index as it frees up. With
+    // a stack size, every worker gets a stack that big, and the calling thread only waits on them.
+    void run_pool(size_t n, size_t workers, const std::function<void(size_t)>& job, size_t stack_bytes = 0);
+
+    // Run job on a thread of it's own with a stack of the given size, waiting for it to finish. If the thread
+    // can't be made, job is run on the calling thread instead.
+    void run_with_stack(size_t stack_bytes, const std::function<void()>& job);
+
+    // The stack to compile a program nested depth deep with, or 0 if the default stack will do.
+    size_t stack_for_depth(size_t depth);
+
+    // Read a manifest of input files, one per line. Blank lines and lines starting with # are skipped,
+    // and relative paths are relative to the manifest. Returns false if it can't be read.
+    bool read_manifest(const std::string& path, std::vector<std::string>& files);
+}
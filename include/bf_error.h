@@ -19,13 +19,30 @@ enum class brain_errc {
     no_err = 0,
     cmd_missing_input,
     cmd_invalid_input,
+    cmd_bad_manifest,
+    cmd_bad_socket,
+    cmd_no_server,
+    cmd_server_lost,
+    cmd_server_accept,
+    cmd_bad_target_cpus,
+    cmd_bad_bundle,
+    cmd_bad_value,
+    cmd_bundle_option,
+    cmd_reentrant_option,
     ast_lbracket,
     ast_rbracket,
+    write_lone_mul,
     gen_bad_init,
+    gen_bad_profile,
     lower_output,
     lower_object,
     lower_clang,
     lower_linking,
+    lower_runtime,
+    lower_lld,
+    lower_interp,
+    jit_bad_init,
+    jit_bad_load,
     unknown
 };
 
@@ -55,12 +72,36 @@ namespace brain {
                     return "missing input file";
                 case brain_errc::cmd_invalid_input:
                     return "invalid input file";
+                case brain_errc::cmd_bad_manifest:
+                    return "could not read the manifest";
+                case brain_errc::cmd_bad_socket:
+                    return "could not listen on the socket, or another server is already using it";
+                case brain_errc::cmd_no_server:
+                    return "could not connect to the compile server";
+                case brain_errc::cmd_server_lost:
+                    return "the compile server closed the connection before replying";
+                case brain_errc::cmd_server_accept:
+                    return "the compile server could not accept connections on the socket";
+                case brain_errc::cmd_bad_target_cpus:
+                    return "--target-cpus takes x86-64, x86-64-v2, x86-64-v3 or x86-64-v4, and needs an x86-64 target";
+                case brain_errc::cmd_bad_bundle:
+                    return "every program in a --bundle is run by it's file name, so those have to be different";
+                case brain_errc::cmd_bad_value:
+                    return "not a value this option can take";
+                case brain_errc::cmd_bundle_option:
+                    return "this option can't be used with --bundle";
+                case brain_errc::cmd_reentrant_option:
+                    return "this option can't be used with --abi or --executor";
                 case brain_errc::ast_lbracket:
                     return "'[' is missing it's closing ']'";
                 case brain_errc::ast_rbracket:
                     return "']' is missing it's opening '['";
+                case brain_errc::write_lone_mul:
+                    return "a multiply without it's clear has no bf to write it as";
                 case brain_errc::gen_bad_init:
                     return "unable to initialize LLVM module";
+                case brain_errc::gen_bad_profile:
+                    return "could not read the profile";
                 case brain_errc::lower_output:
                     return "could not open output file";
                 case brain_errc::lower_object:
@@ -69,6 +110,16 @@ namespace brain {
                     return "could not find clang for linking";
                 case brain_errc::lower_linking:
                     return "unable to link the object file with clang";
+                case brain_errc::lower_runtime:
+                    return "could not find the brainc runtime library";
+                case brain_errc::lower_lld:
+                    return "unable to link the object file with lld";
+                case brain_errc::lower_interp:
+                    return "could not find the dynamic linker brainc was loaded by, to link against";
+                case brain_errc::jit_bad_init:
+                    return "unable to initialize the JIT";
+                case brain_errc::jit_bad_load:
+                    return "unable to load the compiled program into the JIT";
                 default:
                     return "unknown error";
             }
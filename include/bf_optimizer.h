@@ -0,0 +1,88 @@
+// ------------------------------------------------------------
+//  bf_optimizer.h
+//
+//  This pass folds runs and rewrites common idioms in the AST.
+// ------------------------------------------------------------
+
+#pragma once
+
+
+// Include statements.
+#include <memory>
+#include <utility>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <ostream>
+#include <system_error>
+
+#include "util.h"
+#include "ast.h"
+#include "bf_error.h"
+
+
+class bf_optimizer {
+public:
+
+    // Error code for the optimizer pass.
+    std::error_code ec = brain_errc::no_err;
+
+    // What happened to a single loop, at it's 1-based line and column.
+    struct loop_note {
+        size_t line, chr;
+        bool applied;
+        std::string what;
+    };
+
+    // Notes on every loop the optimizer has looked at, for --opt-report.
+    std::vector<loop_note> notes;
+
+    // Whether to apply the superoptimizer's rewrites, and how many runs they replaced.
+    bool superopt = true;
+    size_t rewrites = 0;
+
+    // Constructors and deconstructors.
+    bf_optimizer() = default;
+
+    ~bf_optimizer() = default;
+
+    // Main visitor function.
+    void visit(std::shared_ptr<ast>& t);
+
+    // Print the notes out in source order.
+    void print_report(std::ostream& os) const;
+
+private:
+
+    // Every shape seen so far, keyed by the node's token and it's children, with loops standing in as their shape.
+    std::unordered_map<std::string, size_t> shapes;
+
+    // Fold the children of a root or loop node.
+    void visit_multi(std::shared_ptr<ast>& t);
+
+    // Remove loops that can't be entered, since the cell under the head is known to be zero.
+    void drop_dead_loops(std::shared_ptr<ast>& t);
+
+    // Merge runs of +- and <> into single add and move nodes.
+    std::vector<std::shared_ptr<ast> > fold_runs(std::shared_ptr<ast>& t);
+
+    // Idiom matchers. Each returns true and fills in the replacement nodes on a match.
+    bool match_clear(std::shared_ptr<ast>& t, std::vector<std::shared_ptr<ast> >& out);
+    bool match_scan(std::shared_ptr<ast>& t, std::vector<std::shared_ptr<ast> >& out);
+    bool match_mul(std::shared_ptr<ast>& t, std::vector<std::shared_ptr<ast> >& out);
+
+    // Replace straight runs of ops under t with cheaper ones from the superoptimizer's table, see superopt_table.h.
+    void superoptimize(std::shared_ptr<ast>& t);
+
+    // Turn loops that can only run once into branches, in place.
+    bool match_branch(std::shared_ptr<ast>& t);
+
+    // Give the loops under t their shapes, once everything is folded. Returns t's shape.
+    size_t hash_cons(const std::shared_ptr<ast>& t);
+
+    // Explain why a loop was kept as it is.
+    std::string reject_reason(const std::shared_ptr<ast>& t);
+
+    // Add a note for the given loop.
+    void note(const std::shared_ptr<ast>& t, bool applied, const std::string& what);
+};
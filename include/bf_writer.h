@@ -0,0 +1,50 @@
+// ------------------------------------------------------------
+//  bf_writer.h
+//
+//  This pass writes the (optimized) AST back out as plain bf,
+//  for bf-opt.
+// ------------------------------------------------------------
+
+#pragma once
+
+
+// Include statements.
+#include <memory>
+#include <string>
+#include <vector>
+#include <system_error>
+
+#include "util.h"
+#include "ast.h"
+#include "bf_error.h"
+
+
+class bf_writer {
+public:
+
+    // Error code for the writer pass.
+    std::error_code ec = brain_errc::no_err;
+
+    // The program written out, with no comments or line breaks.
+    std::string prog;
+
+    // Constructors and deconstructors.
+    bf_writer() = default;
+
+    ~bf_writer() = default;
+
+    // Main visitor function.
+    void visit(std::shared_ptr<ast>& t);
+
+    // Steps a plain bf interpreter is expected to take running the tree, one per op, assuming each loop runs
+    // loop_trips times. Folded idioms other than runs count as one step, so it's best on unfolded trees.
+    static double expected_steps(const std::shared_ptr<ast>& t, double loop_trips);
+
+private:
+
+    // Write out the children of a root, loop or branch. Multiply loops are spread over several children.
+    void visit_children(std::shared_ptr<ast>& t);
+
+    // Write out n of either up or down, whichever way the sign of n says.
+    void run(int64_t n, char up, char down);
+};
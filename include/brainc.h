@@ -0,0 +1,65 @@
+// ------------------------------------------------------------
+//  brainc.h
+//
+//  Embedding API of libbrainc. Compiles bf programs inside the
+//  calling process into functions that can be called directly,
+//  without writing out or running an executable. The compiler
+//  passes themselves, see ast_builder.h, bf_optimizer.h,
+//  code_gen.h and lowering.h, are part of the library too.
+// ------------------------------------------------------------
+
+#pragma once
+
+
+// Include statements.
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <system_error>
+
+#include "bf_error.h"
+#include "util.h"
+
+
+namespace brain {
+
+    // How compile builds a program.
+    struct jit_options {
+
+        // LLVM's optimization level, from 0 to 3. The bf optimizer runs for anything above 0.
+        int opt_level = 2;
+    };
+
+    // Where a running program's input comes from and it's output goes. read returns the next byte, or -1 once
+    // there's no more, and write is given each byte output. Either can be null, for no input or to drop the output.
+    struct jit_io {
+        void* user = nullptr;
+        int (*read)(void* user) = nullptr;
+        void (*write)(void* user, uint8_t c) = nullptr;
+    };
+
+    class jit_program {
+    public:
+
+        // Run the program on a caller owned tape of brain::CELL_SIZE cells, with the head starting at the given
+        // cell, and return the cell the head ends up on. Any number of threads can run it at once on their own tapes.
+        uint16_t run(uint8_t* tape, const jit_io& io, uint16_t head = 0) const;
+
+        // Run the program on a fresh tape, with the given input, and return it's output.
+        std::string run(const std::string& input = "") const;
+
+        // Constructors and deconstructors.
+        jit_program(uint16_t (*f)(uint8_t*, uint16_t)): fn(f) {};
+
+        ~jit_program() = default;
+
+    private:
+
+        // The compiled program, which takes the tape and head and returns the new head.
+        uint16_t (*fn)(uint8_t*, uint16_t);
+    };
+
+    // Compile a program's source, or find it already compiled with the same options. On an error, such as
+    // unbalanced brackets, ec is set and nothing is returned. Compiled code stays loaded until the process exits.
+    std::shared_ptr<const jit_program> compile(const std::string& source, const jit_options& options, std::error_code& ec);
+}
@@ -0,0 +1,44 @@
+// ------------------------------------------------------------
+//  budget.h
+//
+//  Picking how to compile a program so it's expected to fit
+//  in the time given by --compile-budget.
+// ------------------------------------------------------------
+
+#pragma once
+
+
+// Include statements.
+#include <memory>
+#include <string>
+
+#include "ast.h"
+
+
+namespace brain {
+
+    // One way to compile a program, along with how long it's expected to take.
+    struct compile_plan {
+        int opt_level = 2;
+        bool light = false;
+        bool outline = false;
+        bool bytecode = false;
+        double estimate_ms = 0;
+
+        // Short name for --stats, e.g. "O1+outline", or "light" for LLVM's light pipeline, see lowering::light.
+        std::string name() const;
+    };
+
+    // Count the loops left in the program.
+    size_t count_loops(const std::shared_ptr<ast>& t);
+
+    // Estimate the time in ms to optimize and compile the already bf optimized program to an object, from the
+    // size and number of loops of each function it'll be split into.
+    double estimate_compile_ms(const std::shared_ptr<ast>& root, const compile_plan& plan, size_t threads);
+
+    // Pick the plan closest to the level and layout asked for that's expected to fit in the budget. Lower levels
+    // are tried next, then the light pipeline, and finally bytecode, which always fits. Programs that have to
+    // stay native get the cheapest native plan instead.
+    compile_plan plan_compile(const std::shared_ptr<ast>& root, int opt_level, bool outline, size_t threads, double budget_ms,
+                              bool native = false);
+}
@@ -0,0 +1,51 @@
+// ------------------------------------------------------------
+//  bytecode.h
+//
+//  This pass generates compact bytecode for the bf virtual
+//  machine from the (optimized) AST.
+// ------------------------------------------------------------
+
+#pragma once
+
+
+// Include statements.
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <system_error>
+
+#include "util.h"
+#include "ast.h"
+#include "bf_error.h"
+#include "vm.h"
+
+
+class bytecode_gen {
+public:
+
+    // Error code for the bytecode pass.
+    std::error_code ec = brain_errc::no_err;
+
+    // The generated program, always terminated by op_halt.
+    std::vector<uint8_t> code;
+
+    // Constructors and deconstructors.
+    bytecode_gen() = default;
+
+    ~bytecode_gen() = default;
+
+    // Main visitor function.
+    void visit(std::shared_ptr<ast>& t);
+
+private:
+
+    // Visitor functions for the nodes that need more than one instruction.
+    void visit_root(std::shared_ptr<ast>& t);
+    void visit_loop(std::shared_ptr<ast>& t);
+
+    // Append a single instruction, packing whichever operands it takes.
+    void emit(brain::opcode op, int64_t a = 0, int64_t b = 0);
+
+    // Write a little endian operand at the given position, appending if it's the end.
+    void put(size_t pos, uint64_t val, size_t bytes);
+};
@@ -0,0 +1,69 @@
+// ------------------------------------------------------------
+//  cache.h
+//
+//  Content addressed cache of compiled outputs, shared between
+//  brainc processes.
+// ------------------------------------------------------------
+
+#pragma once
+
+
+// Include statements.
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+namespace brain {
+
+    class compile_cache {
+    public:
+
+        // Directory the cache lives in, and the most it may hold in bytes.
+        std::string dir;
+        uint64_t limit;
+
+        // Hit and miss counters, as of the last fetch or read_counters.
+        uint64_t hits = 0, misses = 0;
+
+        // Constructors and deconstructors.
+        compile_cache(std::string d, uint64_t l): dir(std::move(d)), limit(l) {};
+
+        ~compile_cache() = default;
+
+        // Hash everything that affects the output into a key.
+        static std::string key(const std::vector<std::string>& parts);
+
+        // Copy key's entry to the output file, returning false on a miss. Either way the counters are updated.
+        bool fetch(const std::string& key, const std::string& output_file);
+
+        // Add the output file as key's entry, then evict the least recently used entries until under the limit.
+        void insert(const std::string& key, const std::string& output_file);
+
+        // The same for entries kept in memory, such as the objects for each region of an --incremental build.
+        bool load(const std::string& key, std::string& data);
+        void store(const std::string& key, const std::string& data);
+
+        // Load the counters, and total up the entries.
+        void read_counters(uint64_t& entries, uint64_t& bytes);
+
+    private:
+
+        // Take the cache wide lock, returning it's file descriptor, or -1 if the cache can't be opened.
+        int lock();
+        void unlock(int fd);
+
+        // Read and write the counters, with the lock held.
+        void load_counters();
+        void save_counters();
+
+        // Count a hit or a miss.
+        void count(bool hit);
+
+        // Put a file into the cache as key's entry, then evict until it fits.
+        void add_entry(const std::string& key, const std::string& tmp);
+    };
+
+    // Cache directory to use when none is given: $BRAINC_CACHE_DIR, then $XDG_CACHE_HOME/brainc, then ~/.cache/brainc.
+    std::string default_cache_dir();
+}
@@ -23,6 +23,9 @@ public:
     // Error code for command parsing.
     std::error_code ec = brain_errc::no_err;
 
+    // The argument check_values found a bad value in.
+    std::string bad_value;
+
     // Constructor and deconstructor.
     cmd_parser() = default;
     cmd_parser(unsigned argc, char** argv) {
@@ -31,6 +34,8 @@ public:
         for (size_t i = 0; i < argc; i++) args.push_back(std::string{argv[i]});
     }
 
+    cmd_parser(std::vector<std::string> a): args(std::move(a)) {};
+
     ~cmd_parser() = default;
 
     // Functions for checking if an option exists, or returning it's associated value.
@@ -41,16 +46,41 @@ public:
     std::string get_input_file();
     size_t get_opt_level();
 
+    // Get every input file given, for batch mode.
+    std::vector<std::string> get_input_files();
+
+    // Arguments for compiling a single file of a batch, with the batch options dropped and the output given by -o.
+    cmd_parser for_input(const std::string& file, const std::string& output);
+
+    // Arguments to send to a compile server, with the client options dropped.
+    std::vector<std::string> for_server();
+
     // Check input file integrity.
     bool check_input_file();
 
+    // Check the numeric options are numbers, so they can be read without checks of their own.
+    bool check_values();
+
 private:
 
     // String consisting of the commandline arguments.
     std::vector<std::string> args;
 
-    // Collection of valid option parameters, and flags.
+    // Options that only make sense for the whole batch, rather than each file in it.
+    const std::unordered_set<std::string> batch_only{"--batch", "--manifest", "--jobs", "--stats", "--stats-json", "--time-passes", "-o"};
+
+    // Options that only make sense to the client, rather than the server running the compile.
+    const std::unordered_set<std::string> client_only{"--client", "--socket"};
+
+    // Whether args[i] is an input file rather than an option or an option's parameter.
+    bool is_input(size_t i);
+
+    // Collection of valid option parameters, and flags. Value options are given as --option=value.
     const std::unordered_set<std::string> arg_parameters{"-o"};
-    const std::unordered_set<std::string> arg_flags{"-h", "--help", "help", "-v", "--version", "-c", "-S"};
+    const std::unordered_set<std::string> arg_values{"--profile-use", "--stats-json", "--cache-dir", "--cache-size", "--manifest", "--jobs", "--socket", "--threads", "--compile-budget", "--target-cpus", "--step-budget"};
+    const std::unordered_set<std::string> arg_flags{"-h", "--help", "help", "-v", "--version", "-c", "-S", "-g", "--bytecode", "--native", "--profile", "--stats", "--time-passes", "--opt-report", "--cache", "--cache-stats", "--batch", "--serve", "--client", "--outline", "--incremental", "--jit", "--abi", "--executor", "--no-dedup", "--bundle"};
     const std::unordered_set<std::string> arg_optimization{"-O0", "-O1", "-O2", "-O3"};
+
+    // Value options that take a whole number.
+    const std::unordered_set<std::string> arg_counts{"--jobs", "--threads", "--step-budget", "--cache-size"};
 };
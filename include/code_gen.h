@@ -10,17 +10,22 @@
 // Include statements.
 #include <memory>
 #include <string>
+#include <vector>
+#include <map>
+#include <unordered_set>
 #include <system_error>
 
 #include "llvm/IR/IRBuilder.h"
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/Instructions.h"
+#include "llvm/IR/DIBuilder.h"
 #include "llvm/ADT/Triple.h"
 #include "llvm/Target/TargetMachine.h"
 
 #include "util.h"
 #include "ast.h"
+#include "profile.h"
 #include "bf_error.h"
 
 
@@ -34,6 +39,33 @@ public:
     // Program name.
     std::string prog_name;
 
+    // Whether to emit DWARF debug info, mapping the code back to the bf source.
+    bool debug_info = false;
+
+    // Whether to count loop iterations and cell accesses, see runtime_profile.cpp.
+    bool profile = false;
+
+    // Split the top level of the program into functions of about this many ops, or 0 to keep it all in main.
+    size_t outline_size = 0;
+
+    // Loop counts from an earlier profile run, used to annotate the loops when given.
+    brain::profile_map prof_use;
+
+    // CPU and features to generate code for, the host's when the CPU is empty.
+    std::string cpu, features;
+
+    // When set, generate the reentrant bf_<abi_name>(tape, len, io) described by abi_header instead of main.
+    std::string abi_name;
+
+    // Stop the program with brain::STEP_EXIT once it's taken this many steps through loops, or 0 for no limit.
+    uint64_t step_budget = 0;
+
+    // Generate the cold copies of identical loops once, as a function they all call, see init_shared.
+    bool dedup = true;
+
+    // How many copies of loops call a shared function, and how many shared functions there are.
+    size_t shared_loops = 0, shared_fns = 0;
+
     // The LLVM context and module to be referenced.
     std::unique_ptr<llvm::LLVMContext> ctx;
     std::unique_ptr<llvm::Module> mod;
@@ -41,23 +73,72 @@ public:
 
     // Constructors and deconstructors.
     code_gen() = default;
-    code_gen(std::string f): prog_name(f) {};
+    code_gen(std::string f, bool g = false): prog_name(f), debug_info(g) {};
 
     ~code_gen() = default;
 
     // Main visitor function for walking the tree and generating LLVM IR.
     void visit(std::shared_ptr<ast>& t);
 
+    // Generate a single region of an --incremental build as an external function, or the main that calls each one.
+    void visit_region(std::vector<std::shared_ptr<ast> >& nodes, const std::string& name);
+    void visit_regions(const std::vector<std::string>& names);
+
+    // Generate a main that hands the given bytecode to the runtime's vm, instead of native code.
+    void visit_bytecode(const std::vector<uint8_t>& code);
+
+    // Generate a main that runs the variant for the highest x86-64 level the CPU supports, given the level
+    // and name of each variant's main, lowest level first.
+    void visit_dispatch(const std::vector<std::pair<int, std::string> >& variants);
+
+    // Generate a main that hands the bf_<abi_name> already generated to the runtime's executor, for --executor.
+    void visit_executor();
+
+    // Generate a main for a --bundle, that has the runtime pick which program to run. Each program is given as
+    // the name it's run by and the name of it's main.
+    void visit_bundle(const std::vector<std::pair<std::string, std::string> >& programs);
+
     // Initialize the context, module, and builder.
     bool initialize_module();
 
+    // C header declaring a bf_<name> function, and the bf_io struct it does it's I/O through. With a step budget
+    // it also documents, and defines BF_OUT_OF_STEPS as, what the function returns once that runs out.
+    static std::string abi_header(const std::string& name, const std::string& source_name, uint64_t step_budget = 0);
+
 private:
 
     // The IR builder that this pass uses.
     std::unique_ptr<llvm::IRBuilder<> > builder;
 
-    // Alloca instructions for the head and tape respectively.
-    llvm::AllocaInst* idx, *cell;
+    // The head and tape respectively. In main these are allocas, in outlined functions the tape is passed in.
+    llvm::Value* idx = nullptr, *cell = nullptr;
+
+    // The bf_io passed to bf_<abi_name>, used for I/O in place of putchar and getchar, and it's type.
+    llvm::Value* io = nullptr;
+    llvm::StructType* io_ty = nullptr;
+
+    // Debug info builder and source file, and the scopes we're in: main, then any nested loops.
+    std::unique_ptr<llvm::DIBuilder> dbuilder;
+    llvm::DIFile* dfile = nullptr;
+    std::vector<llvm::DIScope*> scopes;
+
+    // Profile counters, entries then iterations for each loop, and accesses for each cell.
+    // Loops are numbered in the order they're visited.
+    llvm::GlobalVariable* prof_counts = nullptr, *prof_hist = nullptr;
+    size_t loop_cnt = 0;
+
+    // Loops with at least this many iterations in prof_use are considered hot.
+    uint64_t prof_hot = 0;
+
+    // The steps left of the budget, and the block in the current function that ends the program when they run out.
+    llvm::Value* steps = nullptr;
+    llvm::BasicBlock* out_of_steps = nullptr;
+
+    // Copies of loops to call a shared function for, the function made for each shape, and the copy it's being
+    // made from, which is generated as usual.
+    std::unordered_set<const ast*> shared;
+    std::map<size_t, llvm::Function*> shared_by_shape;
+    const ast* sharing = nullptr;
 
     // All the token-specific visitor functions.
     void visit_root(std::shared_ptr<ast>& t);
@@ -69,7 +150,50 @@ private:
     void visit_rarrow(std::shared_ptr<ast>& t);
     void visit_loop(std::shared_ptr<ast>& t);
 
-    // Helper functions for managing the cell array.
-    llvm::Value* get_cell();
-    void set_cell(llvm::Value* val);
+    // Visitor functions for the folded tokens from the bf optimizer.
+    void visit_add(std::shared_ptr<ast>& t);
+    void visit_move(std::shared_ptr<ast>& t);
+    void visit_clear(std::shared_ptr<ast>& t);
+    void visit_mul(std::shared_ptr<ast>& t);
+    void visit_scan(std::shared_ptr<ast>& t);
+    void visit_branch(std::shared_ptr<ast>& t);
+
+    // Generate a run of top level nodes as a function of their own, and call it.
+    void visit_outlined(std::vector<std::shared_ptr<ast> >& nodes);
+
+    // Call the shared function for a loop's shape, generating it from this copy the first time.
+    void visit_shared(std::shared_ptr<ast>& t);
+
+    // Generate nodes as a function taking the tape and head, see region_type, without moving the builder.
+    llvm::Function* outline(std::vector<std::shared_ptr<ast> >& nodes, const std::string& name, llvm::GlobalValue::LinkageTypes linkage);
+    llvm::FunctionType* region_type();
+
+    // Set up the tape and head of bf_<abi_name> from it's arguments, returning -1 straight away for a short tape.
+    void init_abi(llvm::Function* fn);
+    llvm::StructType* io_type();
+
+    // Helper functions for managing the cell array, optionally at an offset from the head.
+    llvm::Value* get_cell(int64_t off = 0);
+    void set_cell(llvm::Value* val, int64_t off = 0);
+    llvm::Value* cell_ptr(int64_t off, bool count = false);
+
+    // Helper functions for debug info, which are no-ops when it's turned off.
+    void init_debug_info();
+    void declare_debug_vars();
+    void set_location(const std::shared_ptr<ast>& t);
+
+    // Helper functions for profiling.
+    void init_profile(std::shared_ptr<ast>& t);
+    void profile_count(llvm::GlobalVariable* counter, llvm::Value* i);
+
+    // Pick out the copies of loops to share, by their size and how hot they are.
+    void init_shared(const std::shared_ptr<ast>& t);
+
+    // Helper functions for the step budget, see step_budget.
+    void init_steps(llvm::Function* fn, bool top);
+    void charge_steps(uint64_t n);
+
+    // Helper functions for using a recorded profile.
+    void init_profile_use(llvm::Function* main);
+    void annotate_loop(const std::shared_ptr<ast>& t, llvm::BranchInst* cond_br, llvm::BranchInst* latch);
 };
\ No newline at end of file
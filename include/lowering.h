@@ -11,9 +11,17 @@
 #include <memory>
 #include <utility>
 #include <string>
+#include <vector>
+#include <map>
+#include <tuple>
+#include <ostream>
 #include <system_error>
 
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/Module.h"
+#include "llvm/IR/PassInstrumentation.h"
+#include "llvm/IR/PassTimingInfo.h"
 #include "llvm/Target/TargetMachine.h"
 
 #include "bf_error.h"
@@ -25,10 +33,27 @@ public:
     // Error code for the lowering pass.
     std::error_code ec = brain_errc::no_err;
 
+    // The context, only when the module was made here, which has to outlive it.
+    std::unique_ptr<llvm::LLVMContext> ctx;
+
     // The LLVM module/target machine to reference when lowering.
     std::unique_ptr<llvm::Module> mod;
     std::unique_ptr<llvm::TargetMachine> machine;
 
+    // Time each LLVM pass, both while optimizing and during codegen.
+    bool time_passes = false;
+
+    // Count up LLVM's optimization remarks while optimizing.
+    bool collect_remarks = false;
+
+    // Split the module's functions between this many parts, optimized and compiled in parallel. The parts
+    // are separate objects, so this is only for linking, and it's skipped when timing or collecting remarks.
+    size_t threads = 1;
+
+    // Run just a few cheap cleanups instead of the whole pipeline, leaving the loops alone. A --compile-budget
+    // picks this when even -O1 is expected to take too long.
+    bool light = false;
+
     // Constructors and deconstructors.
     lowering() = default;
     lowering(std::unique_ptr<llvm::Module> m, std::unique_ptr<llvm::TargetMachine> tm): mod(std::move(m)), machine(std::move(tm)) {};
@@ -38,9 +63,53 @@ public:
     // Optimize the LLVM IR to a given optimization level.
     void optimize(size_t opt_level);
 
-    // Compile and link respectively. Linking just involkes clang.
-    void compile(std::string output_file, bool target_asm = false);
-    void link(std::string obj_file, std::string exe_file, size_t lto_level = 2);
+    // The compiled asm or object file, kept in memory until it's written out or linked.
+    llvm::SmallVector<char, 0> obj;
+
+    // The parts the module was split into, or the regions of an --incremental build, each with it's own context and object.
+    std::vector<std::unique_ptr<lowering> > parts;
+
+    // Total size of the object, or of all the parts' objects.
+    size_t object_size() const;
+
+    // Compile into obj, then either write it out or link it along with any extra libraries given.
+    // Linking happens in-process with lld when brainc is built with it, otherwise it invokes clang.
+    void compile(bool target_asm = false);
+    void write(const std::string& output_file);
+    void link(std::string exe_file, size_t lto_level = 2, const std::vector<std::string>& libs = {});
+
+    // Path of the runtime library, which lives in lib/ next to the bin/ directory brainc is in.
+    static std::string runtime_lib();
+
+    // Whether brainc was built to link with lld in-process, rather than by running clang.
+    static bool links_in_process();
+
+    // Print the pass timings to stderr, throw them away, or get them as the fields of a JSON object.
+    void report_timings();
+    void clear_timings();
+    std::string timings_json();
+
+    // Print the remarks, grouped by pass, kind and remark name.
+    void print_remarks(std::ostream& os) const;
+
+    // How often a kind of remark came up, with the first message as an example.
+    struct remark_summary {
+        size_t count = 0;
+        std::string example;
+    };
+
+    std::map<std::tuple<std::string, std::string, std::string>, remark_summary> remarks;
 private:
 
+    // The two ways of linking, see link.
+    void link_lld(const std::vector<std::string>& obj_files, const std::string& exe_file, size_t lto_level, const std::vector<std::string>& libs);
+    void link_clang(const std::vector<std::string>& obj_files, const std::string& exe_file, size_t lto_level, const std::vector<std::string>& libs);
+
+    // Split the module up by function into bitcode for each part, or nothing if there's only one function.
+    std::vector<llvm::SmallVector<char, 0> > split();
+
+    // Instrumentation for timing the optimization passes.
+    llvm::PassInstrumentationCallbacks pic;
+    std::unique_ptr<llvm::TimePassesHandler> timers;
+
 };
\ No newline at end of file
@@ -0,0 +1,29 @@
+// ------------------------------------------------------------
+//  profile.h
+//  
+//  Reading back the reports written by --profile executables.
+// ------------------------------------------------------------
+
+#pragma once
+
+
+// Include statements.
+#include <map>
+#include <string>
+#include <utility>
+#include <cstdint>
+
+
+namespace brain {
+
+    // Recorded counts for a single loop.
+    struct loop_counts {
+        uint64_t entries = 0, iterations = 0;
+    };
+
+    // Loop counts, keyed by the loop's 1-based line and column in the source.
+    using profile_map = std::map<std::pair<size_t, size_t>, loop_counts>;
+
+    // Read the loop records out of a profile report. Returns false if it can't be read.
+    bool read_profile(const std::string& path, profile_map& prof);
+}
@@ -0,0 +1,30 @@
+// ------------------------------------------------------------
+//  regions.h
+//
+//  Splitting a program into regions for --incremental builds,
+//  each compiled and cached on it's own.
+// ------------------------------------------------------------
+
+#pragma once
+
+
+// Include statements.
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ast.h"
+
+
+namespace brain {
+
+    // A run of top level nodes, along with their encoding, see brain::encode.
+    struct region {
+        std::vector<std::shared_ptr<ast> > nodes;
+        std::string text;
+    };
+
+    // Split the top level of the program into regions of around size ops. Where a region ends only depends on
+    // the code just before that point, so an edit changes the regions around it and leaves the rest alone.
+    std::vector<region> split_regions(const std::shared_ptr<ast>& root, size_t size);
+}
@@ -0,0 +1,30 @@
+// ------------------------------------------------------------
+//  server.h
+//
+//  Compile server for --serve, and the client side used by
+//  --client, talking over a local Unix socket.
+// ------------------------------------------------------------
+
+#pragma once
+
+
+// Include statements.
+#include <string>
+#include <vector>
+#include <functional>
+#include <system_error>
+
+
+namespace brain {
+
+    // Socket to use when none is given: $BRAINC_SERVER, then $XDG_RUNTIME_DIR/brainc.sock, then /tmp/brainc-<uid>.sock.
+    std::string default_socket();
+
+    // Accept requests on the socket until interrupted. Each one is run by handler in a fork of the server, in the
+    // client's working directory and with it's standard streams, and handler's result is sent back as the exit code.
+    void serve(const std::string& socket, const std::function<int(std::vector<std::string>)>& handler, std::error_code& ec);
+
+    // Send the arguments to the server, along with our working directory and standard streams, and wait for the
+    // exit code. ec is set if the server can't be reached, or goes away before replying.
+    int forward(const std::string& socket, const std::vector<std::string>& args, std::error_code& ec);
+}
@@ -0,0 +1,57 @@
+// ------------------------------------------------------------
+//  stats.h
+//
+//  Per phase timing and memory statistics for --stats.
+// ------------------------------------------------------------
+
+#pragma once
+
+
+// Include statements.
+#include <string>
+#include <vector>
+#include <utility>
+#include <chrono>
+#include <ostream>
+#include <cstdint>
+
+
+namespace brain {
+
+    class compile_stats {
+    public:
+
+        // A single phase of the compiler, along with the sizes of what it produced.
+        struct phase {
+            std::string name;
+            double wall_ms = 0;
+            uint64_t peak_rss_kb = 0;
+            std::vector<std::pair<std::string, uint64_t>> counts;
+            std::vector<std::pair<std::string, std::string>> notes;
+        };
+
+        std::vector<phase> phases;
+
+        // Start timing a new phase, ending the current one if it's still open.
+        void begin(const std::string& name);
+        void end();
+
+        // Record a count against the most recent phase, e.g. the AST nodes for the "ast" phase.
+        void count(const std::string& name, uint64_t val);
+
+        // Record a choice made in the most recent phase, e.g. the plan picked to fit a --compile-budget.
+        void note(const std::string& name, const std::string& text);
+
+        // Print a table for people, or JSON for tools. Any LLVM timer fields are passed in already formatted.
+        void print(std::ostream& os) const;
+        void write_json(std::ostream& os, const std::string& llvm_timers = "") const;
+
+    private:
+
+        std::chrono::steady_clock::time_point start;
+        bool open = false;
+    };
+
+    // Peak resident set size so far in KiB, either of brainc itself or of the programs it has waited on.
+    uint64_t peak_rss_kb(bool children = false);
+}
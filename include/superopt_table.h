@@ -0,0 +1,244 @@
+// ------------------------------------------------------------
+//  superopt_table.h
+//
+//  Rewrites for short straight runs of folded ops, each into
+//  the cheapest run that leaves every cell it touches the
+//  same. Written by bf-superopt, run the superopt target to
+//  remake it rather than editing it by hand.
+// ------------------------------------------------------------
+
+#pragma once
+
+
+// Include statements.
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include "util.h"
+
+
+namespace brain {
+
+    // Longest run in the table, and the most cells any of them touch.
+    const size_t SUPEROPT_MAX_OPS = 8, SUPEROPT_MAX_CELLS = 3;
+
+    // A single op of a replacement.
+    struct rewrite_op {
+        token tok;
+        int64_t val, off;
+    };
+
+    // A run in the form brain::encode writes it, and the run that replaces it.
+    struct rewrite {
+        const char* from;
+        std::vector<rewrite_op> to;
+    };
+
+    const std::vector<rewrite> SUPEROPT_TABLE = {
+        {"(add -1 0)(clear 0 0)", {{clear, 0, 0}}},
+        {"(add -1 0)(mul 3 1)(clear 0 0)(move 1 0)(add -1 0)", {{mul, 3, 1}, {clear, 0, 0}, {move, 1, 0}, {add, -4, 0}}},
+        {"(add -1 0)(mul 3 1)(clear 0 0)(move 1 0)(add 1 0)", {{mul, 3, 1}, {clear, 0, 0}, {move, 1, 0}, {add, -2, 0}}},
+        {"(add -1 0)(mul 5 1)(clear 0 0)(move 1 0)(add -1 0)", {{mul, 5, 1}, {clear, 0, 0}, {move, 1, 0}, {add, -6, 0}}},
+        {"(add -2 0)(mul 3 1)(clear 0 0)(move 1 0)(add 1 0)", {{mul, 3, 1}, {clear, 0, 0}, {move, 1, 0}, {add, -5, 0}}},
+        {"(add -2 0)(mul 4 1)(clear 0 0)(move 1 0)(add -1 0)", {{mul, 4, 1}, {clear, 0, 0}, {move, 1, 0}, {add, -9, 0}}},
+        {"(add -2 0)(mul 4 1)(clear 0 0)(move 1 0)(add 1 0)", {{mul, 4, 1}, {clear, 0, 0}, {move, 1, 0}, {add, -7, 0}}},
+        {"(add -3 0)(mul 3 1)(clear 0 0)(move 1 0)(add 1 0)", {{mul, 3, 1}, {clear, 0, 0}, {move, 1, 0}, {add, -8, 0}}},
+        {"(add -3 0)(mul 4 1)(clear 0 0)(move 1 0)(add -1 0)", {{mul, 4, 1}, {clear, 0, 0}, {move, 1, 0}, {add, -13, 0}}},
+        {"(add -3 0)(mul 4 1)(clear 0 0)(move 1 0)(add 1 0)", {{mul, 4, 1}, {clear, 0, 0}, {move, 1, 0}, {add, -11, 0}}},
+        {"(add -48 0)(move -1 0)(clear 0 0)(move 1 0)(clear 0 0)", {{move, -1, 0}, {clear, 0, 0}, {move, 1, 0}, {clear, 0, 0}}},
+        {"(add -48 0)(move -3 0)(clear 0 0)(move 3 0)(clear 0 0)", {{move, -3, 0}, {clear, 0, 0}, {move, 3, 0}, {clear, 0, 0}}},
+        {"(add 1 0)(mul 3 1)(clear 0 0)(move 1 0)(add 1 0)", {{mul, 3, 1}, {clear, 0, 0}, {move, 1, 0}, {add, 4, 0}}},
+        {"(add 1 0)(mul 3 1)(clear 0 0)(move 1 0)(add 2 0)", {{mul, 3, 1}, {clear, 0, 0}, {move, 1, 0}, {add, 5, 0}}},
+        {"(add 1 0)(mul 4 1)(clear 0 0)(move 1 0)(add 1 0)", {{mul, 4, 1}, {clear, 0, 0}, {move, 1, 0}, {add, 5, 0}}},
+        {"(add 1 0)(mul 6 1)(clear 0 0)(move 1 0)(add 2 0)", {{mul, 6, 1}, {clear, 0, 0}, {move, 1, 0}, {add, 8, 0}}},
+        {"(add 10 0)(mul 5 1)(clear 0 0)(move 1 0)(add 1 0)", {{mul, 5, 1}, {clear, 0, 0}, {move, 1, 0}, {add, 51, 0}}},
+        {"(add 2 0)(mul 3 1)(clear 0 0)(move 1 0)(add 1 0)", {{mul, 3, 1}, {clear, 0, 0}, {move, 1, 0}, {add, 7, 0}}},
+        {"(add 2 0)(mul 3 1)(clear 0 0)(move 1 0)(add 2 0)", {{mul, 3, 1}, {clear, 0, 0}, {move, 1, 0}, {add, 8, 0}}},
+        {"(add 2 0)(mul 4 1)(clear 0 0)(move 1 0)(add 1 0)", {{mul, 4, 1}, {clear, 0, 0}, {move, 1, 0}, {add, 9, 0}}},
+        {"(add 3 0)(mul 3 1)(clear 0 0)(move 1 0)(add 2 0)", {{mul, 3, 1}, {clear, 0, 0}, {move, 1, 0}, {add, 11, 0}}},
+        {"(add 4 0)(mul 2 1)(clear 0 0)(move 1 0)(add 1 0)", {{mul, 2, 1}, {clear, 0, 0}, {move, 1, 0}, {add, 9, 0}}},
+        {"(add 8 0)(mul 8 1)(clear 0 0)(move 1 0)(mul 4 -1)(clear 0 0)", {{mul, 8, 1}, {clear, 0, 0}, {move, 1, 0}, {mul, 4, -1}, {clear, 0, 0}}},
+        {"(clear 0 0)(add 1 0)(mul 1 -2)(mul 1 -1)(clear 0 0)", {{move, -2, 0}, {add, 1, 0}, {move, 1, 0}, {add, 1, 0}, {move, 1, 0}, {clear, 0, 0}}},
+        {"(clear 0 0)(add 1 0)(mul 1 1)(mul 1 2)(clear 0 0)", {{move, 1, 0}, {add, 1, 0}, {move, 1, 0}, {add, 1, 0}, {move, -2, 0}, {clear, 0, 0}}},
+        {"(clear 0 0)(move -1 0)(mul 1 1)(mul 1 2)(clear 0 0)(move 1 0)(mul 1 -1)", {{clear, 0, 0}, {move, -1, 0}, {mul, 1, 1}, {move, 1, 0}, {mul, 1, 1}}},
+        {"(clear 0 0)(move -10 0)(mul 1 10)(mul 1 25)(clear 0 0)(move 10 0)(mul 1 -10)", {{clear, 0, 0}, {move, -10, 0}, {mul, 1, 10}, {move, 10, 0}, {mul, 1, 15}}},
+        {"(clear 0 0)(move -10 0)(mul 1 8)(mul 1 10)(clear 0 0)(move 10 0)(mul 1 -10)", {{clear, 0, 0}, {move, -10, 0}, {mul, 1, 8}, {mul, 1, 10}, {move, 10, 0}}},
+        {"(clear 0 0)(move -10 0)(mul 1 9)(mul 1 10)(clear 0 0)(move 10 0)(mul 1 -10)", {{clear, 0, 0}, {move, -10, 0}, {mul, 1, 9}, {mul, 1, 10}, {move, 10, 0}}},
+        {"(clear 0 0)(move -12 0)(mul 1 11)(mul 1 12)(clear 0 0)(move 12 0)(mul 1 -12)", {{clear, 0, 0}, {move, -12, 0}, {mul, 1, 11}, {mul, 1, 12}, {move, 12, 0}}},
+        {"(clear 0 0)(move -15 0)(mul 1 5)(mul 1 15)(clear 0 0)(move 15 0)(mul 1 -15)", {{clear, 0, 0}, {move, -15, 0}, {mul, 1, 5}, {mul, 1, 15}, {move, 15, 0}}},
+        {"(clear 0 0)(move -16 0)(mul 1 4)(mul 1 16)(clear 0 0)(move 16 0)(mul 1 -16)", {{clear, 0, 0}, {move, -16, 0}, {mul, 1, 4}, {mul, 1, 16}, {move, 16, 0}}},
+        {"(clear 0 0)(move -2 0)(mul 1 1)(mul 1 2)(clear 0 0)(move 2 0)(mul 1 -2)", {{clear, 0, 0}, {move, -2, 0}, {mul, 1, 1}, {mul, 1, 2}, {move, 2, 0}}},
+        {"(clear 0 0)(move -3 0)(mul 1 2)(mul 1 3)(clear 0 0)(move 3 0)(mul 1 -3)", {{clear, 0, 0}, {move, -3, 0}, {mul, 1, 2}, {mul, 1, 3}, {move, 3, 0}}},
+        {"(clear 0 0)(move -3 0)(mul 1 3)(mul 1 6)(clear 0 0)(move 3 0)(mul 1 -3)", {{clear, 0, 0}, {move, -3, 0}, {mul, 1, 3}, {move, 3, 0}, {mul, 1, 3}}},
+        {"(clear 0 0)(move -5 0)(mul 1 4)(mul 1 5)(clear 0 0)(move 5 0)(mul 1 -5)", {{clear, 0, 0}, {move, -5, 0}, {mul, 1, 4}, {mul, 1, 5}, {move, 5, 0}}},
+        {"(clear 0 0)(move -7 0)(mul 1 6)(mul 1 7)(clear 0 0)(move 7 0)(mul 1 -7)", {{clear, 0, 0}, {move, -7, 0}, {mul, 1, 6}, {mul, 1, 7}, {move, 7, 0}}},
+        {"(clear 0 0)(move -8 0)(mul 1 6)(mul 1 8)(clear 0 0)(move 8 0)(mul 1 -8)", {{clear, 0, 0}, {move, -8, 0}, {mul, 1, 6}, {mul, 1, 8}, {move, 8, 0}}},
+        {"(clear 0 0)(move -8 0)(mul 1 7)(mul 1 8)(clear 0 0)(move 8 0)(mul 1 -8)", {{clear, 0, 0}, {move, -8, 0}, {mul, 1, 7}, {mul, 1, 8}, {move, 8, 0}}},
+        {"(clear 0 0)(move -8 0)(mul 1 8)(mul 1 24)(clear 0 0)(move 8 0)(mul 1 -8)", {{clear, 0, 0}, {move, -8, 0}, {mul, 1, 8}, {move, 8, 0}, {mul, 1, 16}}},
+        {"(clear 0 0)(move -9 0)(mul 1 7)(mul 1 9)(clear 0 0)(move 9 0)(mul 1 -9)", {{clear, 0, 0}, {move, -9, 0}, {mul, 1, 7}, {mul, 1, 9}, {move, 9, 0}}},
+        {"(clear 0 0)(move -9 0)(mul 1 8)(mul 1 9)(clear 0 0)(move 9 0)(mul 1 -9)", {{clear, 0, 0}, {move, -9, 0}, {mul, 1, 8}, {mul, 1, 9}, {move, 9, 0}}},
+        {"(clear 0 0)(move -9 0)(mul 1 9)(mul 1 23)(clear 0 0)(move 9 0)(mul 1 -9)", {{clear, 0, 0}, {move, -9, 0}, {mul, 1, 9}, {move, 9, 0}, {mul, 1, 14}}},
+        {"(clear 0 0)(move -9 0)(mul 1 9)(mul 1 26)(clear 0 0)(move 9 0)(mul 1 -9)", {{clear, 0, 0}, {move, -9, 0}, {mul, 1, 9}, {move, 9, 0}, {mul, 1, 17}}},
+        {"(move -1 0)(add -1 0)(move -1 0)(add 1 0)(move 1 0)", {{move, -2, 0}, {add, 1, 0}, {move, 1, 0}, {add, -1, 0}}},
+        {"(move -1 0)(add -100 0)(move -1 0)(add 1 0)(move 1 0)", {{move, -2, 0}, {add, 1, 0}, {move, 1, 0}, {add, -100, 0}}},
+        {"(move -1 0)(add -16 0)(move -1 0)(add 1 0)(move 1 0)", {{move, -2, 0}, {add, 1, 0}, {move, 1, 0}, {add, -16, 0}}},
+        {"(move -1 0)(add -2 0)(move -1 0)(add 1 0)(move 1 0)", {{move, -2, 0}, {add, 1, 0}, {move, 1, 0}, {add, -2, 0}}},
+        {"(move -1 0)(add 9 0)(move 1 0)(mul -1 -1)(clear 0 0)(move 2 0)", {{mul, -1, -1}, {clear, 0, 0}, {move, -1, 0}, {add, 9, 0}, {move, 3, 0}}},
+        {"(move -1 0)(clear 0 0)(add 1 0)(mul 1 1)", {{add, 1, 0}, {move, -1, 0}, {clear, 0, 0}, {add, 1, 0}}},
+        {"(move -1 0)(clear 0 0)(move 1 0)(clear 0 0)(move 1 0)", {{clear, 0, 0}, {move, -1, 0}, {clear, 0, 0}, {move, 2, 0}}},
+        {"(move -2 0)(clear 0 0)(move -1 0)(add -1 0)(move 1 0)", {{move, -3, 0}, {add, -1, 0}, {move, 1, 0}, {clear, 0, 0}}},
+        {"(move -3 0)(clear 0 0)(move 3 0)(clear 0 0)(move 2 0)", {{clear, 0, 0}, {move, -3, 0}, {clear, 0, 0}, {move, 5, 0}}},
+        {"(move -4 0)(add 1 0)(move 1 0)(clear 0 0)(move -1 0)", {{move, -3, 0}, {clear, 0, 0}, {move, -1, 0}, {add, 1, 0}}},
+        {"(move 1 0)(add -1 0)(move -1 0)(mul 4 1)(clear 0 0)(move 1 0)", {{mul, 4, 1}, {clear, 0, 0}, {move, 1, 0}, {add, -1, 0}}},
+        {"(move 1 0)(add -7 0)(move 1 0)(add 1 0)(move -1 0)", {{move, 2, 0}, {add, 1, 0}, {move, -1, 0}, {add, -7, 0}}},
+        {"(move 1 0)(clear 0 0)(add 1 0)(mul 1 -2)(mul 1 -1)", {{add, 1, 0}, {move, -1, 0}, {add, 1, 0}, {move, 2, 0}, {clear, 0, 0}, {add, 1, 0}}},
+        {"(mul 1 -1)(mul 1 3)(clear 0 0)(move -1 0)(mul 1 1)(clear 0 0)", {{mul, 1, 3}, {move, -1, 0}, {mul, 1, 1}, {clear, 0, 0}}},
+        {"(mul 1 -2)(clear 0 0)(move -2 0)(clear 0 0)", {{clear, 0, 0}, {move, -2, 0}, {clear, 0, 0}}},
+        {"(mul 1 -2)(mul 1 -1)(clear 0 0)(move -2 0)(mul 1 2)(clear 0 0)", {{mul, 1, -1}, {move, -2, 0}, {mul, 1, 2}, {clear, 0, 0}}},
+        {"(mul 1 -5)(mul 1 -1)(clear 0 0)(move -5 0)(mul 1 5)(clear 0 0)", {{mul, 1, -1}, {move, -5, 0}, {mul, 1, 5}, {clear, 0, 0}}},
+        {"(mul 1 1)(mul 1 2)(clear 0 0)(move 1 0)(mul 1 -1)(clear 0 0)", {{mul, 1, 2}, {move, 1, 0}, {mul, 1, -1}, {clear, 0, 0}}},
+        {"(mul 1 10)(clear 0 0)(move 10 0)(mul 1 -10)(clear 0 0)", {{move, 10, 0}, {mul, 1, -10}, {clear, 0, 0}}},
+        {"(mul 1 10)(mul 1 11)(clear 0 0)(move 10 0)(mul 1 -10)(clear 0 0)", {{mul, 1, 11}, {move, 10, 0}, {mul, 1, -10}, {clear, 0, 0}}},
+        {"(mul 1 10)(mul 1 24)(clear 0 0)(move 10 0)(mul 1 -10)(clear 0 0)", {{mul, 1, 24}, {move, 10, 0}, {mul, 1, -10}, {clear, 0, 0}}},
+        {"(mul 1 10)(mul 1 25)(clear 0 0)(move 10 0)(mul 1 -10)(clear 0 0)", {{mul, 1, 25}, {move, 10, 0}, {mul, 1, -10}, {clear, 0, 0}}},
+        {"(mul 1 11)(clear 0 0)(move 11 0)(mul 1 -11)(clear 0 0)", {{move, 11, 0}, {mul, 1, -11}, {clear, 0, 0}}},
+        {"(mul 1 11)(mul 1 12)(clear 0 0)(move 11 0)(mul 1 -11)(clear 0 0)", {{mul, 1, 12}, {move, 11, 0}, {mul, 1, -11}, {clear, 0, 0}}},
+        {"(mul 1 11)(mul 1 24)(clear 0 0)(move 11 0)(mul 1 -11)(clear 0 0)", {{mul, 1, 24}, {move, 11, 0}, {mul, 1, -11}, {clear, 0, 0}}},
+        {"(mul 1 12)(clear 0 0)(move 12 0)(mul 1 -12)(clear 0 0)", {{move, 12, 0}, {mul, 1, -12}, {clear, 0, 0}}},
+        {"(mul 1 12)(mul 1 13)(clear 0 0)(move 12 0)(mul 1 -12)(clear 0 0)", {{mul, 1, 13}, {move, 12, 0}, {mul, 1, -12}, {clear, 0, 0}}},
+        {"(mul 1 12)(mul 1 24)(clear 0 0)(move 12 0)(mul 1 -12)(clear 0 0)", {{mul, 1, 24}, {move, 12, 0}, {mul, 1, -12}, {clear, 0, 0}}},
+        {"(mul 1 13)(clear 0 0)(move 13 0)(mul 1 -13)(clear 0 0)", {{move, 13, 0}, {mul, 1, -13}, {clear, 0, 0}}},
+        {"(mul 1 13)(mul 1 14)(clear 0 0)(move 13 0)(mul 1 -13)(clear 0 0)", {{mul, 1, 14}, {move, 13, 0}, {mul, 1, -13}, {clear, 0, 0}}},
+        {"(mul 1 14)(clear 0 0)(move 14 0)(mul 1 -14)(clear 0 0)", {{move, 14, 0}, {mul, 1, -14}, {clear, 0, 0}}},
+        {"(mul 1 14)(mul 1 15)(clear 0 0)(move 14 0)(mul 1 -14)(clear 0 0)", {{mul, 1, 15}, {move, 14, 0}, {mul, 1, -14}, {clear, 0, 0}}},
+        {"(mul 1 15)(clear 0 0)(move 15 0)(mul 1 -15)(clear 0 0)", {{move, 15, 0}, {mul, 1, -15}, {clear, 0, 0}}},
+        {"(mul 1 15)(mul 1 16)(clear 0 0)(move 15 0)(mul 1 -15)(clear 0 0)", {{mul, 1, 16}, {move, 15, 0}, {mul, 1, -15}, {clear, 0, 0}}},
+        {"(mul 1 16)(clear 0 0)(move 16 0)(mul 1 -16)(clear 0 0)", {{move, 16, 0}, {mul, 1, -16}, {clear, 0, 0}}},
+        {"(mul 1 16)(mul 1 17)(clear 0 0)(move 16 0)(mul 1 -16)(clear 0 0)", {{mul, 1, 17}, {move, 16, 0}, {mul, 1, -16}, {clear, 0, 0}}},
+        {"(mul 1 17)(clear 0 0)(move 17 0)(mul 1 -17)(clear 0 0)", {{move, 17, 0}, {mul, 1, -17}, {clear, 0, 0}}},
+        {"(mul 1 17)(mul 1 18)(clear 0 0)(move 17 0)(mul 1 -17)(clear 0 0)", {{mul, 1, 18}, {move, 17, 0}, {mul, 1, -17}, {clear, 0, 0}}},
+        {"(mul 1 18)(clear 0 0)(move 18 0)(mul 1 -18)(clear 0 0)", {{move, 18, 0}, {mul, 1, -18}, {clear, 0, 0}}},
+        {"(mul 1 18)(mul 1 19)(clear 0 0)(move 18 0)(mul 1 -18)(clear 0 0)", {{mul, 1, 19}, {move, 18, 0}, {mul, 1, -18}, {clear, 0, 0}}},
+        {"(mul 1 19)(clear 0 0)(move 19 0)(mul 1 -19)(clear 0 0)", {{move, 19, 0}, {mul, 1, -19}, {clear, 0, 0}}},
+        {"(mul 1 19)(mul 1 20)(clear 0 0)(move 19 0)(mul 1 -19)(clear 0 0)", {{mul, 1, 20}, {move, 19, 0}, {mul, 1, -19}, {clear, 0, 0}}},
+        {"(mul 1 2)(clear 0 0)(add 2 0)(move 2 0)(mul 1 -2)(clear 0 0)", {{move, 2, 0}, {add, 2, 0}, {mul, 1, -2}, {clear, 0, 0}}},
+        {"(mul 1 2)(clear 0 0)(move 2 0)(mul 1 -2)(clear 0 0)", {{move, 2, 0}, {mul, 1, -2}, {clear, 0, 0}}},
+        {"(mul 1 20)(clear 0 0)(move 20 0)(mul 1 -20)(clear 0 0)", {{move, 20, 0}, {mul, 1, -20}, {clear, 0, 0}}},
+        {"(mul 1 20)(mul 1 21)(clear 0 0)(move 20 0)(mul 1 -20)(clear 0 0)", {{mul, 1, 21}, {move, 20, 0}, {mul, 1, -20}, {clear, 0, 0}}},
+        {"(mul 1 21)(clear 0 0)(move 21 0)(mul 1 -21)(clear 0 0)", {{move, 21, 0}, {mul, 1, -21}, {clear, 0, 0}}},
+        {"(mul 1 21)(mul 1 22)(clear 0 0)(move 21 0)(mul 1 -21)(clear 0 0)", {{mul, 1, 22}, {move, 21, 0}, {mul, 1, -21}, {clear, 0, 0}}},
+        {"(mul 1 22)(clear 0 0)(move 22 0)(mul 1 -22)(clear 0 0)", {{move, 22, 0}, {mul, 1, -22}, {clear, 0, 0}}},
+        {"(mul 1 22)(mul 1 23)(clear 0 0)(move 22 0)(mul 1 -22)(clear 0 0)", {{mul, 1, 23}, {move, 22, 0}, {mul, 1, -22}, {clear, 0, 0}}},
+        {"(mul 1 23)(clear 0 0)(move 23 0)(mul 1 -23)(clear 0 0)", {{move, 23, 0}, {mul, 1, -23}, {clear, 0, 0}}},
+        {"(mul 1 23)(mul 1 24)(clear 0 0)(move 23 0)(mul 1 -23)(clear 0 0)", {{mul, 1, 24}, {move, 23, 0}, {mul, 1, -23}, {clear, 0, 0}}},
+        {"(mul 1 24)(clear 0 0)(move 10 0)(mul 1 -10)(clear 0 0)(move 14 0)(add -1 0)(move -21 0)", {{add, -1, 0}, {mul, 1, 24}, {clear, 0, 0}, {move, 10, 0}, {mul, 1, -10}, {clear, 0, 0}, {move, -7, 0}}},
+        {"(mul 1 24)(clear 0 0)(move 12 0)(mul 1 -12)(clear 0 0)(move 12 0)(add -1 0)(move -23 0)", {{add, -1, 0}, {mul, 1, 24}, {clear, 0, 0}, {move, 12, 0}, {mul, 1, -12}, {clear, 0, 0}, {move, -11, 0}}},
+        {"(mul 1 24)(clear 0 0)(move 24 0)(mul 1 -24)(clear 0 0)", {{move, 24, 0}, {mul, 1, -24}, {clear, 0, 0}}},
+        {"(mul 1 24)(mul 1 25)(clear 0 0)(move 24 0)(mul 1 -24)(clear 0 0)", {{mul, 1, 25}, {move, 24, 0}, {mul, 1, -24}, {clear, 0, 0}}},
+        {"(mul 1 25)(clear 0 0)(move 25 0)(mul 1 -25)(clear 0 0)", {{move, 25, 0}, {mul, 1, -25}, {clear, 0, 0}}},
+        {"(mul 1 25)(mul 1 26)(clear 0 0)(move 25 0)(mul 1 -25)(clear 0 0)", {{mul, 1, 26}, {move, 25, 0}, {mul, 1, -25}, {clear, 0, 0}}},
+        {"(mul 1 26)(clear 0 0)(move 26 0)(mul 1 -26)(clear 0 0)", {{move, 26, 0}, {mul, 1, -26}, {clear, 0, 0}}},
+        {"(mul 1 26)(mul 1 27)(clear 0 0)(move 26 0)(mul 1 -26)(clear 0 0)", {{mul, 1, 27}, {move, 26, 0}, {mul, 1, -26}, {clear, 0, 0}}},
+        {"(mul 1 27)(clear 0 0)(move 27 0)(mul 1 -27)(clear 0 0)", {{move, 27, 0}, {mul, 1, -27}, {clear, 0, 0}}},
+        {"(mul 1 27)(mul 1 28)(clear 0 0)(move 27 0)(mul 1 -27)(clear 0 0)", {{mul, 1, 28}, {move, 27, 0}, {mul, 1, -27}, {clear, 0, 0}}},
+        {"(mul 1 28)(clear 0 0)(move 28 0)(mul 1 -28)(clear 0 0)", {{move, 28, 0}, {mul, 1, -28}, {clear, 0, 0}}},
+        {"(mul 1 28)(mul 1 29)(clear 0 0)(move 28 0)(mul 1 -28)(clear 0 0)", {{mul, 1, 29}, {move, 28, 0}, {mul, 1, -28}, {clear, 0, 0}}},
+        {"(mul 1 29)(clear 0 0)(move 29 0)(mul 1 -29)(clear 0 0)", {{move, 29, 0}, {mul, 1, -29}, {clear, 0, 0}}},
+        {"(mul 1 29)(mul 1 30)(clear 0 0)(move 29 0)(mul 1 -29)(clear 0 0)", {{mul, 1, 30}, {move, 29, 0}, {mul, 1, -29}, {clear, 0, 0}}},
+        {"(mul 1 3)(clear 0 0)(move 3 0)(mul 1 -3)(clear 0 0)", {{move, 3, 0}, {mul, 1, -3}, {clear, 0, 0}}},
+        {"(mul 1 3)(mul 1 6)(clear 0 0)(move 3 0)(mul 1 -3)(clear 0 0)", {{mul, 1, 6}, {move, 3, 0}, {mul, 1, -3}, {clear, 0, 0}}},
+        {"(mul 1 30)(clear 0 0)(move 30 0)(mul 1 -30)(clear 0 0)", {{move, 30, 0}, {mul, 1, -30}, {clear, 0, 0}}},
+        {"(mul 1 30)(mul 1 31)(clear 0 0)(move 30 0)(mul 1 -30)(clear 0 0)", {{mul, 1, 31}, {move, 30, 0}, {mul, 1, -30}, {clear, 0, 0}}},
+        {"(mul 1 31)(clear 0 0)(move 31 0)(mul 1 -31)(clear 0 0)", {{move, 31, 0}, {mul, 1, -31}, {clear, 0, 0}}},
+        {"(mul 1 31)(mul 1 32)(clear 0 0)(move 31 0)(mul 1 -31)(clear 0 0)", {{mul, 1, 32}, {move, 31, 0}, {mul, 1, -31}, {clear, 0, 0}}},
+        {"(mul 1 32)(clear 0 0)(move 32 0)(mul 1 -32)(clear 0 0)", {{move, 32, 0}, {mul, 1, -32}, {clear, 0, 0}}},
+        {"(mul 1 32)(mul 1 33)(clear 0 0)(move 32 0)(mul 1 -32)(clear 0 0)", {{mul, 1, 33}, {move, 32, 0}, {mul, 1, -32}, {clear, 0, 0}}},
+        {"(mul 1 33)(clear 0 0)(move 33 0)(mul 1 -33)(clear 0 0)", {{move, 33, 0}, {mul, 1, -33}, {clear, 0, 0}}},
+        {"(mul 1 33)(mul 1 34)(clear 0 0)(move 33 0)(mul 1 -33)(clear 0 0)", {{mul, 1, 34}, {move, 33, 0}, {mul, 1, -33}, {clear, 0, 0}}},
+        {"(mul 1 34)(clear 0 0)(move 34 0)(mul 1 -34)(clear 0 0)", {{move, 34, 0}, {mul, 1, -34}, {clear, 0, 0}}},
+        {"(mul 1 34)(mul 1 35)(clear 0 0)(move 34 0)(mul 1 -34)(clear 0 0)", {{mul, 1, 35}, {move, 34, 0}, {mul, 1, -34}, {clear, 0, 0}}},
+        {"(mul 1 35)(clear 0 0)(move 35 0)(mul 1 -35)(clear 0 0)", {{move, 35, 0}, {mul, 1, -35}, {clear, 0, 0}}},
+        {"(mul 1 35)(mul 1 36)(clear 0 0)(move 35 0)(mul 1 -35)(clear 0 0)", {{mul, 1, 36}, {move, 35, 0}, {mul, 1, -35}, {clear, 0, 0}}},
+        {"(mul 1 36)(clear 0 0)(move 36 0)(mul 1 -36)(clear 0 0)", {{move, 36, 0}, {mul, 1, -36}, {clear, 0, 0}}},
+        {"(mul 1 36)(mul 1 37)(clear 0 0)(move 36 0)(mul 1 -36)(clear 0 0)", {{mul, 1, 37}, {move, 36, 0}, {mul, 1, -36}, {clear, 0, 0}}},
+        {"(mul 1 37)(clear 0 0)(move 37 0)(mul 1 -37)(clear 0 0)", {{move, 37, 0}, {mul, 1, -37}, {clear, 0, 0}}},
+        {"(mul 1 37)(mul 1 38)(clear 0 0)(move 37 0)(mul 1 -37)(clear 0 0)", {{mul, 1, 38}, {move, 37, 0}, {mul, 1, -37}, {clear, 0, 0}}},
+        {"(mul 1 38)(clear 0 0)(move 38 0)(mul 1 -38)(clear 0 0)", {{move, 38, 0}, {mul, 1, -38}, {clear, 0, 0}}},
+        {"(mul 1 38)(mul 1 39)(clear 0 0)(move 38 0)(mul 1 -38)(clear 0 0)", {{mul, 1, 39}, {move, 38, 0}, {mul, 1, -38}, {clear, 0, 0}}},
+        {"(mul 1 39)(clear 0 0)(move 39 0)(mul 1 -39)(clear 0 0)", {{move, 39, 0}, {mul, 1, -39}, {clear, 0, 0}}},
+        {"(mul 1 39)(mul 1 40)(clear 0 0)(move 39 0)(mul 1 -39)(clear 0 0)", {{mul, 1, 40}, {move, 39, 0}, {mul, 1, -39}, {clear, 0, 0}}},
+        {"(mul 1 4)(clear 0 0)(move 4 0)(mul 1 -4)(clear 0 0)", {{move, 4, 0}, {mul, 1, -4}, {clear, 0, 0}}},
+        {"(mul 1 4)(mul 1 5)(clear 0 0)(move 4 0)(mul 1 -4)(clear 0 0)", {{mul, 1, 5}, {move, 4, 0}, {mul, 1, -4}, {clear, 0, 0}}},
+        {"(mul 1 40)(clear 0 0)(move 40 0)(mul 1 -40)(clear 0 0)", {{move, 40, 0}, {mul, 1, -40}, {clear, 0, 0}}},
+        {"(mul 1 40)(mul 1 41)(clear 0 0)(move 40 0)(mul 1 -40)(clear 0 0)", {{mul, 1, 41}, {move, 40, 0}, {mul, 1, -40}, {clear, 0, 0}}},
+        {"(mul 1 41)(clear 0 0)(move 41 0)(mul 1 -41)(clear 0 0)", {{move, 41, 0}, {mul, 1, -41}, {clear, 0, 0}}},
+        {"(mul 1 41)(mul 1 42)(clear 0 0)(move 41 0)(mul 1 -41)(clear 0 0)", {{mul, 1, 42}, {move, 41, 0}, {mul, 1, -41}, {clear, 0, 0}}},
+        {"(mul 1 42)(clear 0 0)(move 42 0)(mul 1 -42)(clear 0 0)", {{move, 42, 0}, {mul, 1, -42}, {clear, 0, 0}}},
+        {"(mul 1 42)(mul 1 43)(clear 0 0)(move 42 0)(mul 1 -42)(clear 0 0)", {{mul, 1, 43}, {move, 42, 0}, {mul, 1, -42}, {clear, 0, 0}}},
+        {"(mul 1 43)(clear 0 0)(move 43 0)(mul 1 -43)(clear 0 0)", {{move, 43, 0}, {mul, 1, -43}, {clear, 0, 0}}},
+        {"(mul 1 43)(mul 1 44)(clear 0 0)(move 43 0)(mul 1 -43)(clear 0 0)", {{mul, 1, 44}, {move, 43, 0}, {mul, 1, -43}, {clear, 0, 0}}},
+        {"(mul 1 44)(clear 0 0)(move 44 0)(mul 1 -44)(clear 0 0)", {{move, 44, 0}, {mul, 1, -44}, {clear, 0, 0}}},
+        {"(mul 1 44)(mul 1 45)(clear 0 0)(move 44 0)(mul 1 -44)(clear 0 0)", {{mul, 1, 45}, {move, 44, 0}, {mul, 1, -44}, {clear, 0, 0}}},
+        {"(mul 1 45)(clear 0 0)(move 45 0)(mul 1 -45)(clear 0 0)", {{move, 45, 0}, {mul, 1, -45}, {clear, 0, 0}}},
+        {"(mul 1 45)(mul 1 46)(clear 0 0)(move 45 0)(mul 1 -45)(clear 0 0)", {{mul, 1, 46}, {move, 45, 0}, {mul, 1, -45}, {clear, 0, 0}}},
+        {"(mul 1 46)(clear 0 0)(move 46 0)(mul 1 -46)(clear 0 0)", {{move, 46, 0}, {mul, 1, -46}, {clear, 0, 0}}},
+        {"(mul 1 46)(mul 1 47)(clear 0 0)(move 46 0)(mul 1 -46)(clear 0 0)", {{mul, 1, 47}, {move, 46, 0}, {mul, 1, -46}, {clear, 0, 0}}},
+        {"(mul 1 47)(clear 0 0)(move 47 0)(mul 1 -47)(clear 0 0)", {{move, 47, 0}, {mul, 1, -47}, {clear, 0, 0}}},
+        {"(mul 1 47)(mul 1 48)(clear 0 0)(move 47 0)(mul 1 -47)(clear 0 0)", {{mul, 1, 48}, {move, 47, 0}, {mul, 1, -47}, {clear, 0, 0}}},
+        {"(mul 1 48)(clear 0 0)(move 48 0)(mul 1 -48)(clear 0 0)", {{move, 48, 0}, {mul, 1, -48}, {clear, 0, 0}}},
+        {"(mul 1 48)(mul 1 49)(clear 0 0)(move 48 0)(mul 1 -48)(clear 0 0)", {{mul, 1, 49}, {move, 48, 0}, {mul, 1, -48}, {clear, 0, 0}}},
+        {"(mul 1 49)(clear 0 0)(move 49 0)(mul 1 -49)(clear 0 0)", {{move, 49, 0}, {mul, 1, -49}, {clear, 0, 0}}},
+        {"(mul 1 49)(mul 1 50)(clear 0 0)(move 49 0)(mul 1 -49)(clear 0 0)", {{mul, 1, 50}, {move, 49, 0}, {mul, 1, -49}, {clear, 0, 0}}},
+        {"(mul 1 5)(clear 0 0)(move 5 0)(mul 1 -5)(clear 0 0)", {{move, 5, 0}, {mul, 1, -5}, {clear, 0, 0}}},
+        {"(mul 1 5)(mul 1 6)(clear 0 0)(move 5 0)(mul 1 -5)(clear 0 0)", {{mul, 1, 6}, {move, 5, 0}, {mul, 1, -5}, {clear, 0, 0}}},
+        {"(mul 1 50)(clear 0 0)(move 50 0)(mul 1 -50)(clear 0 0)", {{move, 50, 0}, {mul, 1, -50}, {clear, 0, 0}}},
+        {"(mul 1 50)(mul 1 51)(clear 0 0)(move 50 0)(mul 1 -50)(clear 0 0)", {{mul, 1, 51}, {move, 50, 0}, {mul, 1, -50}, {clear, 0, 0}}},
+        {"(mul 1 51)(clear 0 0)(move 51 0)(mul 1 -51)(clear 0 0)", {{move, 51, 0}, {mul, 1, -51}, {clear, 0, 0}}},
+        {"(mul 1 51)(mul 1 52)(clear 0 0)(move 51 0)(mul 1 -51)(clear 0 0)", {{mul, 1, 52}, {move, 51, 0}, {mul, 1, -51}, {clear, 0, 0}}},
+        {"(mul 1 52)(clear 0 0)(move 52 0)(mul 1 -52)(clear 0 0)", {{move, 52, 0}, {mul, 1, -52}, {clear, 0, 0}}},
+        {"(mul 1 52)(mul 1 53)(clear 0 0)(move 52 0)(mul 1 -52)(clear 0 0)", {{mul, 1, 53}, {move, 52, 0}, {mul, 1, -52}, {clear, 0, 0}}},
+        {"(mul 1 53)(clear 0 0)(move 53 0)(mul 1 -53)(clear 0 0)", {{move, 53, 0}, {mul, 1, -53}, {clear, 0, 0}}},
+        {"(mul 1 53)(mul 1 54)(clear 0 0)(move 53 0)(mul 1 -53)(clear 0 0)", {{mul, 1, 54}, {move, 53, 0}, {mul, 1, -53}, {clear, 0, 0}}},
+        {"(mul 1 54)(clear 0 0)(move 54 0)(mul 1 -54)(clear 0 0)", {{move, 54, 0}, {mul, 1, -54}, {clear, 0, 0}}},
+        {"(mul 1 54)(mul 1 55)(clear 0 0)(move 54 0)(mul 1 -54)(clear 0 0)", {{mul, 1, 55}, {move, 54, 0}, {mul, 1, -54}, {clear, 0, 0}}},
+        {"(mul 1 55)(clear 0 0)(move 55 0)(mul 1 -55)(clear 0 0)", {{move, 55, 0}, {mul, 1, -55}, {clear, 0, 0}}},
+        {"(mul 1 55)(mul 1 56)(clear 0 0)(move 55 0)(mul 1 -55)(clear 0 0)", {{mul, 1, 56}, {move, 55, 0}, {mul, 1, -55}, {clear, 0, 0}}},
+        {"(mul 1 56)(clear 0 0)(move 56 0)(mul 1 -56)(clear 0 0)", {{move, 56, 0}, {mul, 1, -56}, {clear, 0, 0}}},
+        {"(mul 1 56)(mul 1 57)(clear 0 0)(move 56 0)(mul 1 -56)(clear 0 0)", {{mul, 1, 57}, {move, 56, 0}, {mul, 1, -56}, {clear, 0, 0}}},
+        {"(mul 1 57)(clear 0 0)(move 57 0)(mul 1 -57)(clear 0 0)", {{move, 57, 0}, {mul, 1, -57}, {clear, 0, 0}}},
+        {"(mul 1 57)(mul 1 58)(clear 0 0)(move 57 0)(mul 1 -57)(clear 0 0)", {{mul, 1, 58}, {move, 57, 0}, {mul, 1, -57}, {clear, 0, 0}}},
+        {"(mul 1 58)(clear 0 0)(move 58 0)(mul 1 -58)(clear 0 0)", {{move, 58, 0}, {mul, 1, -58}, {clear, 0, 0}}},
+        {"(mul 1 58)(mul 1 59)(clear 0 0)(move 58 0)(mul 1 -58)(clear 0 0)", {{mul, 1, 59}, {move, 58, 0}, {mul, 1, -58}, {clear, 0, 0}}},
+        {"(mul 1 59)(clear 0 0)(move 59 0)(mul 1 -59)(clear 0 0)", {{move, 59, 0}, {mul, 1, -59}, {clear, 0, 0}}},
+        {"(mul 1 59)(mul 1 60)(clear 0 0)(move 59 0)(mul 1 -59)(clear 0 0)", {{mul, 1, 60}, {move, 59, 0}, {mul, 1, -59}, {clear, 0, 0}}},
+        {"(mul 1 6)(clear 0 0)(move 6 0)(mul 1 -6)(clear 0 0)", {{move, 6, 0}, {mul, 1, -6}, {clear, 0, 0}}},
+        {"(mul 1 6)(mul 1 7)(clear 0 0)(move 6 0)(mul 1 -6)(clear 0 0)", {{mul, 1, 7}, {move, 6, 0}, {mul, 1, -6}, {clear, 0, 0}}},
+        {"(mul 1 60)(clear 0 0)(move 60 0)(mul 1 -60)(clear 0 0)", {{move, 60, 0}, {mul, 1, -60}, {clear, 0, 0}}},
+        {"(mul 1 60)(mul 1 61)(clear 0 0)(move 60 0)(mul 1 -60)(clear 0 0)", {{mul, 1, 61}, {move, 60, 0}, {mul, 1, -60}, {clear, 0, 0}}},
+        {"(mul 1 61)(clear 0 0)(move 61 0)(mul 1 -61)(clear 0 0)", {{move, 61, 0}, {mul, 1, -61}, {clear, 0, 0}}},
+        {"(mul 1 61)(mul 1 62)(clear 0 0)(move 61 0)(mul 1 -61)(clear 0 0)", {{mul, 1, 62}, {move, 61, 0}, {mul, 1, -61}, {clear, 0, 0}}},
+        {"(mul 1 62)(clear 0 0)(move 62 0)(mul 1 -62)(clear 0 0)", {{move, 62, 0}, {mul, 1, -62}, {clear, 0, 0}}},
+        {"(mul 1 62)(mul 1 63)(clear 0 0)(move 62 0)(mul 1 -62)(clear 0 0)", {{mul, 1, 63}, {move, 62, 0}, {mul, 1, -62}, {clear, 0, 0}}},
+        {"(mul 1 63)(clear 0 0)(move 63 0)(mul 1 -63)(clear 0 0)", {{move, 63, 0}, {mul, 1, -63}, {clear, 0, 0}}},
+        {"(mul 1 63)(mul 1 64)(clear 0 0)(move 63 0)(mul 1 -63)(clear 0 0)", {{mul, 1, 64}, {move, 63, 0}, {mul, 1, -63}, {clear, 0, 0}}},
+        {"(mul 1 64)(clear 0 0)(move 64 0)(mul 1 -64)(clear 0 0)", {{move, 64, 0}, {mul, 1, -64}, {clear, 0, 0}}},
+        {"(mul 1 64)(mul 1 65)(clear 0 0)(move 64 0)(mul 1 -64)(clear 0 0)", {{mul, 1, 65}, {move, 64, 0}, {mul, 1, -64}, {clear, 0, 0}}},
+        {"(mul 1 65)(clear 0 0)(move 65 0)(mul 1 -65)(clear 0 0)", {{move, 65, 0}, {mul, 1, -65}, {clear, 0, 0}}},
+        {"(mul 1 65)(mul 1 66)(clear 0 0)(move 65 0)(mul 1 -65)(clear 0 0)", {{mul, 1, 66}, {move, 65, 0}, {mul, 1, -65}, {clear, 0, 0}}},
+        {"(mul 1 66)(clear 0 0)(move 66 0)(mul 1 -66)(clear 0 0)", {{move, 66, 0}, {mul, 1, -66}, {clear, 0, 0}}},
+        {"(mul 1 66)(mul 1 67)(clear 0 0)(move 66 0)(mul 1 -66)(clear 0 0)", {{mul, 1, 67}, {move, 66, 0}, {mul, 1, -66}, {clear, 0, 0}}},
+        {"(mul 1 67)(clear 0 0)(move 67 0)(mul 1 -67)(clear 0 0)", {{move, 67, 0}, {mul, 1, -67}, {clear, 0, 0}}},
+        {"(mul 1 7)(clear 0 0)(move 7 0)(mul 1 -7)(clear 0 0)", {{move, 7, 0}, {mul, 1, -7}, {clear, 0, 0}}},
+        {"(mul 1 7)(mul 1 22)(clear 0 0)(move 7 0)(mul 1 -7)(clear 0 0)", {{mul, 1, 22}, {move, 7, 0}, {mul, 1, -7}, {clear, 0, 0}}},
+        {"(mul 1 7)(mul 1 8)(clear 0 0)(move 7 0)(mul 1 -7)(clear 0 0)", {{mul, 1, 8}, {move, 7, 0}, {mul, 1, -7}, {clear, 0, 0}}},
+        {"(mul 1 8)(clear 0 0)(move 8 0)(mul 1 -8)(clear 0 0)", {{move, 8, 0}, {mul, 1, -8}, {clear, 0, 0}}},
+        {"(mul 1 8)(mul 1 24)(clear 0 0)(move 8 0)(mul 1 -8)(clear 0 0)", {{mul, 1, 24}, {move, 8, 0}, {mul, 1, -8}, {clear, 0, 0}}},
+        {"(mul 1 8)(mul 1 9)(clear 0 0)(move 8 0)(mul 1 -8)(clear 0 0)", {{mul, 1, 9}, {move, 8, 0}, {mul, 1, -8}, {clear, 0, 0}}},
+        {"(mul 1 9)(clear 0 0)(move 9 0)(mul 1 -9)(clear 0 0)", {{move, 9, 0}, {mul, 1, -9}, {clear, 0, 0}}},
+        {"(mul 1 9)(mul 1 10)(clear 0 0)(move 9 0)(mul 1 -9)(clear 0 0)", {{mul, 1, 10}, {move, 9, 0}, {mul, 1, -9}, {clear, 0, 0}}},
+        {"(mul 1 9)(mul 1 23)(clear 0 0)(move 9 0)(mul 1 -9)(clear 0 0)", {{mul, 1, 23}, {move, 9, 0}, {mul, 1, -9}, {clear, 0, 0}}},
+        {"(mul 1 9)(mul 1 26)(clear 0 0)(move 9 0)(mul 1 -9)(clear 0 0)", {{mul, 1, 26}, {move, 9, 0}, {mul, 1, -9}, {clear, 0, 0}}},
+        {"(mul 4 1)(clear 0 0)(move 1 0)(mul 8 -1)(clear 0 0)(move -1 0)(mul 8 1)(clear 0 0)", {{clear, 0, 0}, {move, 1, 0}, {mul, 8, -1}, {clear, 0, 0}, {move, -1, 0}, {mul, 8, 1}, {clear, 0, 0}}},
+    };
+}
@@ -0,0 +1,28 @@
+// ------------------------------------------------------------
+//  targets.h
+//
+//  The x86-64 microarchitecture levels a program can be built
+//  for with --target-cpus.
+// ------------------------------------------------------------
+
+#pragma once
+
+
+// Include statements.
+#include <string>
+#include <vector>
+
+
+namespace brain {
+
+    // A level from the x86-64 psABI, with the LLVM features it adds on top of plain x86-64.
+    struct cpu_level {
+        std::string name;
+        int level;
+        std::string features;
+    };
+
+    // Look up each level in a comma separated list, e.g. "x86-64-v2,x86-64-v3", giving them lowest first with
+    // no repeats. Returns false if any of them isn't a level.
+    bool parse_cpu_levels(const std::string& list, std::vector<cpu_level>& levels);
+}
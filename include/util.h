@@ -12,6 +12,7 @@
 #include <memory>
 #include <utility>
 #include <string>
+#include <cstdint>
 
 
 struct ast;
@@ -26,8 +27,28 @@ namespace brain {
     // for a bigger array this wrapping needs to be implemented.
     const size_t CELL_SIZE = 65536;
 
+    // Programs with more ops than this are compiled in bytecode mode by default.
+    const size_t BYTECODE_THRESHOLD = 65536;
+
+    // Ops per function when outlining the top level of a program.
+    const size_t OUTLINE_SIZE = 2048;
+
+    // Identical loops with at least this many ops are generated once and shared by their cold copies.
+    const size_t SHARE_MIN_SIZE = 32;
+
+    // Exit code of a program that ran out of --step-budget, the same as timeout(1) so it looks like one.
+    const int STEP_EXIT = 124;
+
+    // Stack the passes use for each level of loop nesting they recurse through, on top of a thread's usual 8 MiB.
+    // Programs nested deeper than SHALLOW_DEPTH are compiled on a thread with a stack sized to match.
+    const size_t STACK_PER_LEVEL = 1024;
+    const size_t SHALLOW_DEPTH = 2048;
+
+    // Default size limit of the compile cache, in MiB.
+    const uint64_t CACHE_SIZE_MB = 512;
+
     // Usage string.
-    const std::string USAGE = "\x1B[33mUsage:\033[0m brainc [-hv] [-cS] [-O<n>] <input file> [-o <output file>]\n";
+    const std::string USAGE = "\x1B[33mUsage:\033[0m brainc [-hv] [-cSg] [-O<n>] [--jit] [--abi] [--executor] [--bytecode | --native] [--profile | --profile-use=<file>] [--stats] [--stats-json=<file>] [--time-passes] [--opt-report] [--cache] [--cache-dir=<dir>] [--cache-size=<MiB>] [--cache-stats] [--batch | --bundle] [--manifest=<file>] [--jobs=<n>] [--outline] [--threads=<n>] [--incremental] [--compile-budget=<ms>] [--target-cpus=<levels>] [--step-budget=<n>] [--no-dedup] [--serve | --client] [--socket=<path>] <input file>... [-o <output file>]\n";
 
     // Options info string.
     const std::string OPTIONS = "Options:\n"
@@ -36,7 +57,70 @@ namespace brain {
                                 "  -o <output file>     Specify the name of the output file.\n"
                                 "  -O<n>                Set the optimization level. -O2 is default.\n"
                                 "  -c                   Only compile to an object file, do not assemble and link.\n"
-                                "  -S                   Only compile and assemble, do not link.\n";
+                                "  -S                   Only compile and assemble, do not link.\n"
+                                "  -g                   Generate debug info that maps back to the bf source lines and columns.\n"
+                                "  --jit                Compile the program in memory and run it straight away, instead of writing an executable.\n"
+                                "  --abi                Compile to an object with a reentrant bf_<name>(tape, len, io) instead of main,\n"
+                                "                       and a C header declaring it, named after the input and output files.\n"
+                                "  --executor           Build an executable that runs many copies of the program at once on one thread, one\n"
+                                "                       per connection to the socket given when it's run, or just one on stdin and stdout.\n"
+                                "                       Neither it nor --abi can be used with --bytecode, --profile, --outline,\n"
+                                "                       --compile-budget or --target-cpus.\n"
+                                "  --bytecode           Embed the program as bytecode run by a small vm, for a small binary.\n"
+                                "  --native             Always compile to native code, even for very large programs.\n"
+                                "  --profile            Count loop iterations and tape accesses, reported in <name>.prof at exit.\n"
+                                "  --profile-use=<file> Optimize using the loop counts recorded in a --profile report.\n"
+                                "  --stats              Print the time, peak memory and output size of each phase to stderr.\n"
+                                "  --stats-json=<file>  Write the phase statistics and LLVM pass timers as JSON, - for stdout.\n"
+                                "  --time-passes        Print the time taken by each LLVM pass to stderr.\n"
+                                "  --opt-report         Print what was done to each loop, or why it was left alone, and LLVM's remarks to stderr.\n"
+                                "  --cache              Reuse the output of an identical earlier compile, from ~/.cache/brainc or $BRAINC_CACHE_DIR.\n"
+                                "  --cache-dir=<dir>    Use the given cache directory, implies --cache.\n"
+                                "  --cache-size=<MiB>   Evict the least recently used outputs past this size. 512 is default.\n"
+                                "  --cache-stats        Print the cache's hit and miss counters, and it's size.\n"
+                                "  --batch              Compile every input file given, in parallel. -o names the output directory.\n"
+                                "  --bundle             Compile every input file into one executable, named by -o, that runs the program\n"
+                                "                       it's run as, like busybox, or the one named by it's first argument. Symlink it\n"
+                                "                       under each name printed by <bundle> --list. Can't be used with -c, -S, --abi,\n"
+                                "                       --executor, --profile, --profile-use, --outline or --target-cpus.\n"
+                                "  --manifest=<file>    Also compile the files listed in the given file, one per line. Implies --batch without --bundle.\n"
+                                "  --jobs=<n>           Number of files to compile at once in batch or bundle mode. Defaults to the number of cores.\n"
+                                "  --outline            Split the top level of the program into functions, so big programs compile faster.\n"
+                                "  --threads=<n>        Optimize and compile the functions on this many threads. Defaults to the number of cores.\n"
+                                "  --incremental        Compile the program in regions, cached separately, so a rebuild only compiles what changed.\n"
+                                "  --compile-budget=<ms>\n"
+                                "                       Outline, lower the level or fall back to bytecode so the compile is expected to\n"
+                                "                       take no longer than this. Always runs the bf optimizer. --stats shows the plan.\n"
+                                "  --target-cpus=<levels>\n"
+                                "                       Build a variant for each comma separated x86-64 level, e.g. x86-64-v2,x86-64-v3,\n"
+                                "                       and run the best one the CPU supports. Only for executables.\n"
+                                "  --step-budget=<n>    Stop the program with exit code 124 once it's taken n steps through loops, where a\n"
+                                "                       step is one op after the bf optimizer. Output so far is flushed.\n"
+                                "  --no-dedup           Generate every copy of identical loops inline, rather than sharing one function\n"
+                                "                       between the copies outside of other loops, or the cold ones with --profile-use.\n"
+                                "  --serve              Run a compile server, keeping LLVM loaded and warm, until interrupted.\n"
+                                "  --client             Have the compile server run this compile. Also done when $BRAINC_SERVER is set,\n"
+                                "                       falling back to compiling locally if the server isn't running.\n"
+                                "  --socket=<path>      Socket for --serve and --client. Defaults to $BRAINC_SERVER, or one in $XDG_RUNTIME_DIR.\n";
+
+    // Usage and options strings for the bytecode interpreter.
+    const std::string VM_USAGE = "\x1B[33mUsage:\033[0m brainvm [-hv] [-O<n>] <input file>\n";
+
+    const std::string VM_OPTIONS = "Options:\n"
+                                   "  -h, --help           Display this information.\n"
+                                   "  -v, --version        Display the version information.\n"
+                                   "  -O<n>                Set the optimization level. -O0 disables superinstructions.\n";
+
+    // Usage and options strings for the bf to bf optimizer.
+    const std::string OPT_USAGE = "\x1B[33mUsage:\033[0m bf-opt [-hv] <input file> [-o <output file>]\n";
+
+    const std::string OPT_OPTIONS = "Options:\n"
+                                    "  -h, --help           Display this information.\n"
+                                    "  -v, --version        Display the version information.\n"
+                                    "  -o <output file>     Where the optimized program goes, stdout by default.\n";
+
+    // Iterations bf-opt assumes each loop runs, when estimating the steps saved.
+    const double OPT_LOOP_TRIPS = 16;
 
     const std::string VERSION = "Big Brain Compiler (c) 2023 Noah Gergel\n"
                                 "v1.1\n";
@@ -51,6 +135,14 @@ namespace brain {
         comma,
         larrow,
         rarrow,
+
+        // Folded tokens produced by the bf optimizer, see bf_optimizer.h.
+        add,
+        move,
+        clear,
+        mul,
+        scan,
+        branch,
         nil
     };
 
@@ -63,6 +155,15 @@ namespace brain {
     // Given a character, return the appropriate token.
     token get_token(char c);
 
+    // Count the number of ops in the program, not including the root.
+    size_t count_nodes(const std::shared_ptr<ast>& t);
+
+    // Deepest nesting of loops in the source, without checking that the brackets balance.
+    size_t nesting_depth(const std::string& prog);
+
+    // Append a canonical text form of a node and it's children to out, for hashing. Positions are left out.
+    void encode(const std::shared_ptr<ast>& t, std::string& out);
+
     // Print out the bf program, for debugging purposes.
     void print_prog(std::shared_ptr<ast>& t);
 
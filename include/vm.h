@@ -0,0 +1,40 @@
+// ------------------------------------------------------------
+//  vm.h
+//
+//  Instruction set and threaded interpreter for the bf
+//  bytecode. Doesn't depend on the rest of the compiler, so it
+//  can be built into the runtime library on its own.
+// ------------------------------------------------------------
+
+#pragma once
+
+
+// Include statements.
+#include <cstddef>
+#include <cstdint>
+
+
+namespace brain {
+
+    // The head is 16 bits wide so it wraps for free, which fixes the tape size. Matches brain::CELL_SIZE.
+    const size_t VM_TAPE_SIZE = 65536;
+
+    // Opcodes understood by the vm. The folded tokens and idioms map to superinstructions.
+    // Each opcode is a single byte, followed by its operands packed in little endian.
+    enum opcode : uint8_t {
+        op_add,     // u8 n:        cell += n
+        op_move,    // i16 n:       head += n
+        op_out,     //              putchar(cell)
+        op_in,      //              cell = getchar()
+        op_jz,      // u32 a:       if (!cell) goto a
+        op_jnz,     // u32 a:       if (cell) goto a
+        op_clear,   //              cell = 0
+        op_mul,     // i16 o, u8 n: cell[head + o] += cell * n
+        op_scan,    // i16 n:       while (cell) head += n
+        op_halt,
+        op_count
+    };
+
+    // Run a program terminated by op_halt, on a tape of VM_TAPE_SIZE cells.
+    void vm_run(const uint8_t* code, uint8_t* tape);
+}
@@ -50,7 +50,10 @@ void ast_builder::visit(std::shared_ptr<ast>& t) {
 //  visit_multi
 // 
 //  Visit a node that will potentially have children.
-//  In bf, this only applies to the root or loop nodes.
+//  In bf, this only applies to the root or loop nodes. The
+//  whole subtree is built in one pass over the program, with
+//  a stack of the loops we're inside, so nesting costs no
+//  more than anything else and doesn't use the call stack.
 // ------------------------------------------------------------
 void ast_builder::visit_multi(std::shared_ptr<ast>& t) {
 
@@ -60,30 +63,26 @@ void ast_builder::visit_multi(std::shared_ptr<ast>& t) {
     // Once at the beginning, do a syntax check.
     if (t->token == brain::root && !check_syntax()) return;
 
-    // Get the end of the program that we will look at.
-    size_t end = t->token == brain::root ? prog.length() : loop_lookahead(t->idx);
-
     // Initialize the line, char, and index numbers.
     size_t line = t->line, chr = t->chr, i = t->idx;
     if (t->token != brain::root) incr_idx(i, line, chr);
 
-    // Scan through the program visiting valid tokens.
-    while (i < end) {
+    // Scan through the program until the node's closing bracket, or the end for the root.
+    std::vector<std::shared_ptr<ast> > open = {t};
 
-        // Make a new AST node and walk the tree if we have a valid token.
-        if (brain::valid_token(prog[i])) {
-            std::shared_ptr<ast> child = std::make_shared<ast>(brain::get_token(prog[i]), t, line, chr, i);
-            t->children.push_back(child);
-            visit(child);
-
-            // Also move the index if the child's a loop, so we don't copy it twice.
-            if (child->token == brain::loop) {
-                size_t loop_end = loop_lookahead(i);
-                while (i < loop_end) incr_idx(i, line, chr);
-            }
+    for (; i < prog.length() && !open.empty(); incr_idx(i, line, chr)) {
+        if (prog[i] == ']') {
+            open.pop_back();
+            continue;
         }
 
-        incr_idx(i, line, chr);
+        // Make a new AST node if we have a valid token, and go inside it if it's a loop.
+        if (brain::valid_token(prog[i])) {
+            std::shared_ptr<ast> child = std::make_shared<ast>(brain::get_token(prog[i]), open.back(), line, chr, i);
+            open.back()->children.push_back(child);
+
+            if (child->token == brain::loop) open.push_back(child);
+        }
     }
 }
 
@@ -97,31 +96,6 @@ void ast_builder::visit_multi(std::shared_ptr<ast>& t) {
 void ast_builder::visit_single(std::shared_ptr<ast>& t) {}
 
 
-// ------------------------------------------------------------
-//  loop_lookahead
-// 
-//  Scan through the program looking for the index of the
-//  closing bracket, where the opening bracket is at start.
-// ------------------------------------------------------------
-size_t ast_builder::loop_lookahead(size_t start) {
-
-    // Assert that start is at the right token.
-    if (brain::DEBUG) assert(prog.length() > start && prog[start] == '[');
-
-    // We can nest loops, use cnt to find the matching right bracket.
-    size_t cnt = 0, end = 0;
-
-    // Loop through each character until we find the closing bracket.
-    for (size_t i = start + 1; i < prog.length() && !end; i++) {
-        if (prog[i] == '[') cnt++;
-        else if (prog[i] == ']') cnt ? cnt-- : end = i;
-    }
-
-    // Return the index of the closing right bracket.
-    return end;
-}
-
-
 // ------------------------------------------------------------
 //  incr_idx
 // 
@@ -0,0 +1,131 @@
+// ------------------------------------------------------------
+//  batch.cpp
+//
+//  Worker pool and manifest reading for batch mode.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <atomic>
+#include <thread>
+#include <fstream>
+#include <filesystem>
+#include <pthread.h>
+
+#include "batch.h"
+#include "util.h"
+
+
+// ------------------------------------------------------------
+//  start_thread
+//
+//  std::thread can't be given a stack size, so this goes
+//  straight to pthreads. The stack is only reserved, pages
+//  are touched as the passes recurse into them.
+// ------------------------------------------------------------
+static bool start_thread(size_t stack_bytes, const std::function<void()>& job, pthread_t& thread) {
+
+    pthread_attr_t attr;
+
+    auto start = [](void* arg) -> void* {
+        (*(const std::function<void()>*) arg)();
+        return nullptr;
+    };
+
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, stack_bytes);
+
+    bool started = pthread_create(&thread, &attr, start, (void*) &job) == 0;
+
+    pthread_attr_destroy(&attr);
+    return started;
+}
+
+
+// ------------------------------------------------------------
+//  run_pool
+//
+//  Jobs are handed out one at a time rather than split up
+//  front, since compile times vary a lot between programs.
+// ------------------------------------------------------------
+void brain::run_pool(size_t n, size_t workers, const std::function<void(size_t)>& job, size_t stack_bytes) {
+
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> pool;
+
+    std::function<void()> work = [&] {
+        for (size_t i = next++; i < n; i = next++) job(i);
+    };
+
+    // Workers with big stacks are all threads of their own, but if none can be made the calling thread does it all.
+    if (stack_bytes) {
+        std::vector<pthread_t> threads;
+
+        for (size_t w = 0; w < workers && w < n; w++) {
+            pthread_t thread;
+            if (start_thread(stack_bytes, work, thread)) threads.push_back(thread);
+        }
+
+        if (threads.empty()) work();
+        for (pthread_t thread : threads) pthread_join(thread, nullptr);
+
+        return;
+    }
+
+    // The calling thread counts as one of the workers.
+    for (size_t w = 1; w < workers && w < n; w++) pool.emplace_back(work);
+    work();
+
+    for (std::thread& t : pool) t.join();
+}
+
+
+// ------------------------------------------------------------
+//  run_with_stack
+//
+//  Start the one thread, see start_thread, and wait for it.
+// ------------------------------------------------------------
+void brain::run_with_stack(size_t stack_bytes, const std::function<void()>& job) {
+
+    pthread_t thread;
+
+    if (start_thread(stack_bytes, job, thread)) pthread_join(thread, nullptr);
+    else job();
+}
+
+
+// ------------------------------------------------------------
+//  stack_for_depth
+//
+//  Every pass after the AST builder recurses through the
+//  loops, so the stack grows with the nesting.
+// ------------------------------------------------------------
+size_t brain::stack_for_depth(size_t depth) {
+
+    return depth > brain::SHALLOW_DEPTH ? (8 << 20) + depth * brain::STACK_PER_LEVEL : 0;
+}
+
+
+// ------------------------------------------------------------
+//  read_manifest
+//
+//  Read in the list of files, trimming whitespace.
+// ------------------------------------------------------------
+bool brain::read_manifest(const std::string& path, std::vector<std::string>& files) {
+
+    std::ifstream ifs(path);
+    if (!ifs) return false;
+
+    std::filesystem::path base = std::filesystem::path(path).parent_path();
+    std::string line;
+
+    while (std::getline(ifs, line)) {
+        size_t start = line.find_first_not_of(" \t\r"), end = line.find_last_not_of(" \t\r");
+        if (start == std::string::npos || line[start] == '#') continue;
+
+        std::filesystem::path file = line.substr(start, end - start + 1);
+        files.push_back((file.is_absolute() ? file : base / file).string());
+    }
+
+    return true;
+}
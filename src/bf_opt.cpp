@@ -0,0 +1,123 @@
+// ------------------------------------------------------------
+//  bf_opt.cpp
+//
+//  Entry point for bf-opt, which runs the frontend and the bf
+//  optimizer, then writes the program back out as equivalent
+//  bf. Comments, cancelling runs and dead loops are gone, and
+//  the idioms are in their canonical form, so the output runs
+//  faster on any interpreter, not just ours.
+// ------------------------------------------------------------
+
+// Include statments.
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdio>
+#include <system_error>
+
+#include "util.h"
+#include "ast_builder.h"
+#include "bf_optimizer.h"
+#include "bf_writer.h"
+#include "cmd_parser.h"
+#include "bf_error.h"
+
+
+// ------------------------------------------------------------
+//  report
+//
+//  Print how much smaller the program got, in ops and in the
+//  steps it's expected to take.
+// ------------------------------------------------------------
+static void report(const std::string& what, double before, double after) {
+
+    fprintf(stderr, "%-6s %14.0f -> %-14.0f (%+.1f%%)\n", what.c_str(), before, after, before > 0 ? (after / before - 1) * 100 : 0.0);
+}
+
+
+int main(int argc, char** argv) {
+
+    // Initialize the command argument parser.
+    cmd_parser input(argc, argv);
+
+    // Printing the help message takes priority over all other input arguments.
+    if (input.option_exists("-h") || input.option_exists("--help") || input.option_exists("help")) {
+        std::cout << brain::VERSION << std::endl << brain::OPT_USAGE << brain::OPT_OPTIONS << std::endl;
+        return 0;
+    }
+
+    // Print the version and exit.
+    if (input.option_exists("-v") || input.option_exists("--version")) {
+        std::cout << brain::VERSION;
+        return 0;
+    }
+
+    // Make sure at least the input file is given, and that it is a valid file.
+    if (!input.check_input_file()) {
+        std::cerr << brain::err_msg(input.ec.message());
+        std::cerr << brain::OPT_USAGE;
+        return 2;
+    }
+
+    // Read in the file.
+    std::ifstream ifs(input.get_input_file());
+    std::stringstream bf_prog;
+    bf_prog << ifs.rdbuf();
+
+    // Build the AST, and measure it before it's optimized.
+    ast_builder ast_pass(bf_prog.str());
+    std::shared_ptr<ast> tree = std::make_shared<ast>(brain::root);
+    ast_pass.visit(tree);
+
+    if (ast_pass.ec != brain_errc::no_err) {
+        std::cerr << brain::err_msg(ast_pass.ec.message(), ast_pass.err_node);
+        return 1;
+    }
+
+    size_t ops = brain::count_nodes(tree);
+    double steps = bf_writer::expected_steps(tree, brain::OPT_LOOP_TRIPS);
+
+    // Optimize, and write it back out.
+    bf_optimizer opt_pass;
+
+    // The superoptimizer's rewrites can leave a mul without it's clear, which has no bf of it's own.
+    opt_pass.superopt = false;
+    opt_pass.visit(tree);
+
+    bf_writer write_pass;
+    write_pass.visit(tree);
+
+    // Measure the output the same way as the input, by reading it back in.
+    ast_builder out_pass(write_pass.prog);
+    std::shared_ptr<ast> out_tree = std::make_shared<ast>(brain::root);
+    out_pass.visit(out_tree);
+
+    if (write_pass.ec != brain_errc::no_err) {
+        std::cerr << brain::err_msg(write_pass.ec.message());
+        return 1;
+    }
+
+    if (out_pass.ec != brain_errc::no_err) {
+        std::cerr << brain::err_msg(make_error_code(brain_errc::unknown).message());
+        return 1;
+    }
+
+    if (input.option_exists("-o")) {
+        std::ofstream ofs(input.get_option("-o"));
+        ofs << write_pass.prog << "\n";
+
+        if (!ofs) {
+            std::cerr << brain::err_msg(make_error_code(brain_errc::lower_output).message());
+            return 1;
+        }
+    } else {
+        std::cout << write_pass.prog << "\n";
+    }
+
+    report("ops", ops, brain::count_nodes(out_tree));
+    report("steps", steps, bf_writer::expected_steps(out_tree, brain::OPT_LOOP_TRIPS));
+    fprintf(stderr, "steps are expected, assuming every loop runs %.0f times\n", brain::OPT_LOOP_TRIPS);
+
+    return 0;
+}
@@ -0,0 +1,437 @@
+// ------------------------------------------------------------
+//  bf_optimizer.cpp
+//
+//  Implementation of the bf level optimizer pass.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <cassert>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <algorithm>
+
+#include "util.h"
+#include "bf_optimizer.h"
+#include "superopt_table.h"
+#include "bf_error.h"
+
+
+// ------------------------------------------------------------
+//  make_folded
+//
+//  Make a new folded node at the source position of src.
+// ------------------------------------------------------------
+static std::shared_ptr<ast> make_folded(brain::token tok, const std::shared_ptr<ast>& src, int64_t val = 0, int64_t off = 0) {
+    std::shared_ptr<ast> node = std::make_shared<ast>(tok, src->parent, src->line, src->chr, src->idx);
+    node->val = val, node->off = off;
+    return node;
+}
+
+
+// ------------------------------------------------------------
+//  wrap_cell / wrap_idx
+//
+//  Normalize an amount to the range of a cell or the head.
+// ------------------------------------------------------------
+static int64_t wrap_cell(int64_t v) {
+    v = ((v % 256) + 256) % 256;
+    return v > 128 ? v - 256 : v;
+}
+
+static int64_t wrap_idx(int64_t v) {
+    v = ((v % (int64_t) brain::CELL_SIZE) + brain::CELL_SIZE) % brain::CELL_SIZE;
+    return v > (int64_t) brain::CELL_SIZE / 2 ? v - (int64_t) brain::CELL_SIZE : v;
+}
+
+
+// ------------------------------------------------------------
+//  visit
+//
+//  General visit function for the optimizer.
+// ------------------------------------------------------------
+void bf_optimizer::visit(std::shared_ptr<ast>& t) {
+
+    // Make sure we aren't visiting a nil token in the AST.
+    if (brain::DEBUG) assert(t->token != brain::nil);
+
+    // Don't proceed if we've already hit an error.
+    if (ec != brain_errc::no_err) return;
+
+    // Only the root and loops have anything to fold.
+    if (t->token == brain::root || t->token == brain::loop || t->token == brain::branch) visit_multi(t);
+
+    // The rewrites go in last, so the idioms and branches are all matched against the runs they know.
+    if (t->token == brain::root && superopt) superoptimize(t);
+
+    // With the whole program folded, identical loops can be found.
+    if (t->token == brain::root) hash_cons(t);
+}
+
+
+// ------------------------------------------------------------
+//  visit_multi
+//
+//  Fold the children of a node, then try to replace each of
+//  the child loops with an idiom.
+// ------------------------------------------------------------
+void bf_optimizer::visit_multi(std::shared_ptr<ast>& t) {
+
+    // There's no point optimizing loops that will never run.
+    drop_dead_loops(t);
+
+    // Optimize inside out, so the idioms see already folded loop bodies.
+    for (std::shared_ptr<ast>& c : t->children) {
+        if (c->token == brain::loop || c->token == brain::branch) visit(c);
+    }
+
+    std::vector<std::shared_ptr<ast> > folded = fold_runs(t), children;
+
+    // Swap out any loops that match an idiom.
+    for (std::shared_ptr<ast>& c : folded) {
+        if (c->token == brain::loop
+            && (match_clear(c, children) || match_scan(c, children) || match_mul(c, children))) continue;
+
+        if (c->token == brain::loop && !match_branch(c)) note(c, false, reject_reason(c));
+        children.push_back(c);
+    }
+
+    t->children = std::move(children);
+}
+
+
+// ------------------------------------------------------------
+//  drop_dead_loops
+//
+//  Track whether the cell under the head is known to be zero,
+//  and remove any loop reached while it is. This catches
+//  comment loops, and loops straight after another loop.
+// ------------------------------------------------------------
+void bf_optimizer::drop_dead_loops(std::shared_ptr<ast>& t) {
+
+    // The tape starts out all zero, so until something is written the head is on a zero wherever it is.
+    bool zero = t->token == brain::root, clean = zero;
+    std::vector<std::shared_ptr<ast> > live;
+
+    for (std::shared_ptr<ast>& c : t->children) {
+        if (c->token == brain::loop && zero) {
+            note(c, true, "evaluated at compile time, never entered");
+            continue;
+        }
+
+        live.push_back(c);
+
+        switch (c->token) {
+            case brain::loop:
+            case brain::branch:
+            case brain::clear:
+            case brain::scan: zero = true; break;
+            case brain::larrow:
+            case brain::rarrow:
+            case brain::move: zero = clean; break;
+            case brain::period: break;
+            case brain::mul: clean = false; break;
+            default: zero = clean = false;
+        }
+    }
+
+    t->children = std::move(live);
+}
+
+
+// ------------------------------------------------------------
+//  fold_runs
+//
+//  Merge consecutive +- and <> tokens, dropping any that
+//  cancel out entirely.
+// ------------------------------------------------------------
+std::vector<std::shared_ptr<ast> > bf_optimizer::fold_runs(std::shared_ptr<ast>& t) {
+
+    std::vector<std::shared_ptr<ast> > out;
+
+    for (std::shared_ptr<ast>& c : t->children) {
+
+        // Work out what this node folds into, if anything.
+        brain::token tok = brain::nil;
+        int64_t amt = 0;
+
+        switch (c->token) {
+            case brain::plus: tok = brain::add, amt = 1; break;
+            case brain::minus: tok = brain::add, amt = -1; break;
+            case brain::rarrow: tok = brain::move, amt = 1; break;
+            case brain::larrow: tok = brain::move, amt = -1; break;
+            case brain::add:
+            case brain::move: tok = c->token, amt = c->val; break;
+            default: break;
+        }
+
+        if (tok == brain::nil) {
+            out.push_back(c);
+            continue;
+        }
+
+        // Either extend the previous run or start a new one.
+        if (!out.empty() && out.back()->token == tok) out.back()->val += amt;
+        else out.push_back(make_folded(tok, c, amt));
+
+        // Runs that cancel out are removed, so the run before them can keep folding.
+        std::shared_ptr<ast>& last = out.back();
+        last->val = tok == brain::add ? wrap_cell(last->val) : wrap_idx(last->val);
+        if (last->val == 0) out.pop_back();
+    }
+
+    return out;
+}
+
+
+// ------------------------------------------------------------
+//  match_clear
+//
+//  Match [-] and friends, any loop adding an odd amount.
+// ------------------------------------------------------------
+bool bf_optimizer::match_clear(std::shared_ptr<ast>& t, std::vector<std::shared_ptr<ast> >& out) {
+
+    // An odd step is guaranteed to hit zero, an even one might loop forever.
+    if (t->children.size() != 1 || t->children[0]->token != brain::add || !(t->children[0]->val & 1)) return false;
+
+    out.push_back(make_folded(brain::clear, t));
+    note(t, true, "folded into a clear");
+    return true;
+}
+
+
+// ------------------------------------------------------------
+//  match_scan
+//
+//  Match [>] and [<] style loops, searching for a zero cell.
+// ------------------------------------------------------------
+bool bf_optimizer::match_scan(std::shared_ptr<ast>& t, std::vector<std::shared_ptr<ast> >& out) {
+
+    if (t->children.size() != 1 || t->children[0]->token != brain::move) return false;
+
+    out.push_back(make_folded(brain::scan, t, t->children[0]->val));
+    note(t, true, "scan loop, stride " + std::to_string(t->children[0]->val));
+    return true;
+}
+
+
+// ------------------------------------------------------------
+//  match_mul
+//
+//  Match balanced loops that decrement the current cell once
+//  and add multiples of it to other cells, e.g. [->++>+<<].
+// ------------------------------------------------------------
+bool bf_optimizer::match_mul(std::shared_ptr<ast>& t, std::vector<std::shared_ptr<ast> >& out) {
+
+    // Total up the amount added to each offset.
+    std::map<int64_t, int64_t> deltas;
+    int64_t off = 0;
+
+    for (std::shared_ptr<ast>& c : t->children) {
+        if (c->token == brain::add) deltas[off] += c->val;
+        else if (c->token == brain::move) off += c->val;
+        else return false;
+    }
+
+    // The head has to end where it started, and the counter has to step by one.
+    int64_t step = wrap_cell(deltas[0]);
+    if (off != 0 || (step != 1 && step != -1)) return false;
+
+    // Counting up runs the loop 256 - n times, which is the same as adding -n.
+    size_t targets = 0;
+
+    for (auto& d : deltas) {
+        if (d.first == 0 || wrap_cell(d.second) == 0) continue;
+        out.push_back(make_folded(brain::mul, t, wrap_cell(step == -1 ? d.second : -d.second), d.first));
+        targets++;
+    }
+
+    out.push_back(make_folded(brain::clear, t));
+    note(t, true, "multiply loop into " + std::to_string(targets) + " cell" + (targets == 1 ? "" : "s"));
+    return true;
+}
+
+
+// ------------------------------------------------------------
+//  superoptimize
+//
+//  Look each straight run up in the table, replacing the
+//  longest run starting at each op that has a rewrite. The
+//  table only holds the shortest runs that can be improved,
+//  so each body goes around again until nothing changes.
+// ------------------------------------------------------------
+void bf_optimizer::superoptimize(std::shared_ptr<ast>& t) {
+
+    static const std::unordered_map<std::string, const std::vector<brain::rewrite_op>*> table = [] {
+        std::unordered_map<std::string, const std::vector<brain::rewrite_op>*> m;
+        for (const brain::rewrite& r : brain::SUPEROPT_TABLE) m.emplace(r.from, &r.to);
+        return m;
+    }();
+
+    if (table.empty()) return;
+
+    auto straight = [](const std::shared_ptr<ast>& c) {
+        return c->token == brain::add || c->token == brain::move || c->token == brain::clear || c->token == brain::mul;
+    };
+
+    // Loops can nest arbitrarily deep, so walk them with a stack rather than recursing.
+    std::vector<std::shared_ptr<ast> > stack{t};
+
+    while (!stack.empty()) {
+        std::shared_ptr<ast> node = stack.back();
+        stack.pop_back();
+
+        for (std::shared_ptr<ast>& c : node->children) {
+            if (c->token == brain::loop || c->token == brain::branch) stack.push_back(c);
+        }
+
+        for (bool changed = true; changed;) {
+            std::vector<std::shared_ptr<ast> > out;
+            changed = false;
+
+            for (size_t i = 0; i < node->children.size();) {
+                const std::vector<brain::rewrite_op>* best = nullptr;
+                size_t len = 0;
+                std::string key;
+
+                for (size_t j = i; j < node->children.size() && j - i < brain::SUPEROPT_MAX_OPS && straight(node->children[j]); j++) {
+                    brain::encode(node->children[j], key);
+
+                    auto it = table.find(key);
+                    if (it != table.end()) best = it->second, len = j - i + 1;
+                }
+
+                if (!best) {
+                    out.push_back(node->children[i++]);
+                    continue;
+                }
+
+                for (const brain::rewrite_op& o : *best) out.push_back(make_folded(o.tok, node->children[i], o.val, o.off));
+
+                i += len, rewrites++, changed = true;
+            }
+
+            node->children = std::move(out);
+        }
+    }
+}
+
+
+// ------------------------------------------------------------
+//  match_branch
+//
+//  A loop whose body ends on a zero cell, e.g. one ending in
+//  a clear or another loop, can only go around once.
+// ------------------------------------------------------------
+bool bf_optimizer::match_branch(std::shared_ptr<ast>& t) {
+
+    if (t->children.empty()) return false;
+
+    switch (t->children.back()->token) {
+        case brain::loop:
+        case brain::branch:
+        case brain::clear:
+        case brain::scan: break;
+        default: return false;
+    }
+
+    t->token = brain::branch;
+    note(t, true, "converted to a branch, the body runs at most once");
+    return true;
+}
+
+
+// ------------------------------------------------------------
+//  hash_cons
+//
+//  Key each node by it's children, with nested loops keyed by
+//  the shape already found for them, so every node is only
+//  looked at once however deep it is. Positions are left out,
+//  and moves are relative, so loops anywhere on the tape that
+//  do the same thing get the same shape.
+// ------------------------------------------------------------
+size_t bf_optimizer::hash_cons(const std::shared_ptr<ast>& t) {
+
+    std::string key = brain::token_name(t->token);
+
+    for (const std::shared_ptr<ast>& c : t->children) {
+        if (c->token == brain::loop || c->token == brain::branch) key += "#" + std::to_string(hash_cons(c));
+        else key += "(" + brain::token_name(c->token) + " " + std::to_string(c->val) + " " + std::to_string(c->off) + ")";
+    }
+
+    t->shape = shapes.emplace(key, shapes.size() + 1).first->second;
+    return t->shape;
+}
+
+
+// ------------------------------------------------------------
+//  reject_reason
+//
+//  Work out which of the idioms' requirements the already
+//  folded loop body doesn't meet.
+// ------------------------------------------------------------
+std::string bf_optimizer::reject_reason(const std::shared_ptr<ast>& t) {
+
+    if (t->children.empty()) return "empty body, never exits once entered";
+
+    std::map<int64_t, int64_t> deltas;
+    int64_t off = 0;
+    bool writes = false;
+
+    for (const std::shared_ptr<ast>& c : t->children) {
+        switch (c->token) {
+            case brain::period:
+            case brain::comma: return "body does i/o";
+            case brain::loop:
+            case brain::branch: return "body has a nested loop that couldn't be folded";
+            case brain::scan: return "body has a scan, so the head moves by an unknown amount";
+            case brain::add: deltas[off] += c->val; break;
+            case brain::move: off += c->val; break;
+            default: writes = true;
+        }
+    }
+
+    if (off != 0) return "head moves by " + std::to_string(off) + " each iteration";
+    if (writes) return "body clears or multiplies other cells";
+
+    int64_t step = wrap_cell(deltas[0]);
+    if (step == 0) return "loop cell isn't changed by the body";
+
+    return "loop cell steps by " + std::to_string(step) + " each iteration, not by 1";
+}
+
+
+// ------------------------------------------------------------
+//  note
+//
+//  Record what happened to a loop.
+// ------------------------------------------------------------
+void bf_optimizer::note(const std::shared_ptr<ast>& t, bool applied, const std::string& what) {
+    notes.push_back({t->line + 1, t->chr + 1, applied, what});
+}
+
+
+// ------------------------------------------------------------
+//  print_report
+//
+//  Print every loop by position, then a count of how many
+//  were transformed, and of the runs the table rewrote.
+// ------------------------------------------------------------
+void bf_optimizer::print_report(std::ostream& os) const {
+
+    std::vector<loop_note> sorted = notes;
+    std::sort(sorted.begin(), sorted.end(), [](const loop_note& a, const loop_note& b) {
+        return std::make_pair(a.line, a.chr) < std::make_pair(b.line, b.chr);
+    });
+
+    size_t applied = 0;
+
+    for (const loop_note& n : sorted) {
+        os << "  " << n.line << ":" << n.chr << ": " << (n.applied ? "" : "kept, ") << n.what << "\n";
+        applied += n.applied;
+    }
+
+    os << "  " << sorted.size() << " loops, " << applied << " transformed, " << sorted.size() - applied << " kept\n";
+    os << "  " << rewrites << " straight run" << (rewrites == 1 ? "" : "s") << " rewritten from the superoptimizer's table\n";
+}
@@ -0,0 +1,655 @@
+// ------------------------------------------------------------
+//  bf_superopt.cpp
+//
+//  Entry point for bf-superopt, which finds the cheapest run
+//  of folded ops for each short straight run in a corpus of
+//  programs. Each rewrite is proved by running both runs on
+//  every state of the cells they touch, then it goes into the
+//  table the bf optimizer applies, see superopt_table.h.
+// ------------------------------------------------------------
+
+// Include statments.
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+#include "util.h"
+#include "ast_builder.h"
+#include "bf_optimizer.h"
+
+
+// Most cells a run can touch. Proving a rewrite over four cells takes every one of 2^32 states.
+static const size_t MAX_CELLS = 4;
+
+static const std::string USAGE = "\x1B[33mUsage:\033[0m bf-superopt [-h] [--cells=<n>] [--max-ops=<n>] [--table=<file>] <input files>\n";
+
+static const std::string OPTIONS = "Options:\n"
+                                   "  -h, --help           Display this information.\n"
+                                   "  --cells=<n>          Most cells a run can touch, 3 is default and 4 is the limit.\n"
+                                   "  --max-ops=<n>        Longest run to look at, 8 is default.\n"
+                                   "  --table=<file>       Write the rewrites out as a table for the bf optimizer, e.g. include/superopt_table.h.\n";
+
+
+// A single folded op, moves and mul targets are relative to the head.
+struct op {
+    brain::token tok;
+    int64_t val, off;
+};
+
+typedef std::vector<op> run;
+
+// What a run does to the cells it touches, cell = a * cells + b for each of them, and where it leaves the head.
+struct effect {
+    uint8_t a[MAX_CELLS][MAX_CELLS], b[MAX_CELLS];
+    int64_t head;
+
+    bool operator==(const effect& o) const {
+        return !memcmp(a, o.a, sizeof(a)) && !memcmp(b, o.b, sizeof(b)) && head == o.head;
+    }
+};
+
+// A run from the corpus, the cells it touches, and how often it turned up.
+struct fragment {
+    run ops;
+    std::vector<int64_t> cells;
+    size_t seen = 0;
+    std::set<std::string> files;
+};
+
+// A proven rewrite, and how much cheaper it is.
+struct found {
+    std::string from;
+    run to;
+    size_t saved, seen;
+    std::set<std::string> files;
+};
+
+
+// ------------------------------------------------------------
+//  wrap_cell
+//
+//  Normalize an amount to the range of a cell, the same way
+//  the bf optimizer does.
+// ------------------------------------------------------------
+static int64_t wrap_cell(int64_t v) {
+    v = ((v % 256) + 256) % 256;
+    return v > 128 ? v - 256 : v;
+}
+
+
+// ------------------------------------------------------------
+//  cost
+//
+//  What an op costs. A move is one dispatch in the vm, but
+//  folds into the addressing of the next op when compiled,
+//  while a mul reads one cell and writes another, so the mul
+//  counts double. Fewer muls are worth an extra move.
+// ------------------------------------------------------------
+static size_t cost(const op& o) {
+    return o.tok == brain::mul ? 2 : 1;
+}
+
+static size_t cost(const run& r) {
+
+    size_t total = 0;
+    for (const op& o : r) total += cost(o);
+
+    return total;
+}
+
+
+// ------------------------------------------------------------
+//  encode
+//
+//  The text form of a run, as brain::encode writes each op.
+// ------------------------------------------------------------
+static std::string encode(const run& r) {
+
+    std::string out;
+    for (const op& o : r) out += "(" + brain::token_name(o.tok) + " " + std::to_string(o.val) + " " + std::to_string(o.off) + ")";
+
+    return out;
+}
+
+
+// ------------------------------------------------------------
+//  touched
+//
+//  The cells a run reads or writes, relative to where the
+//  head starts, in order.
+// ------------------------------------------------------------
+static std::vector<int64_t> touched(const run& r) {
+
+    std::set<int64_t> cells;
+    int64_t head = 0;
+
+    for (const op& o : r) {
+        if (o.tok == brain::move) head += o.val;
+        else cells.insert(head);
+
+        if (o.tok == brain::mul) cells.insert(head + o.off);
+    }
+
+    return std::vector<int64_t>(cells.begin(), cells.end());
+}
+
+
+// ------------------------------------------------------------
+//  apply
+//
+//  Step an effect through one op. Every op is affine over the
+//  cells, so the effect stays exact however long the run is.
+//  Returns false if the op touches a cell outside of cells.
+// ------------------------------------------------------------
+static bool apply(effect& e, const op& o, const std::vector<int64_t>& cells) {
+
+    if (o.tok == brain::move) {
+        e.head += o.val;
+        return true;
+    }
+
+    auto at = [&](int64_t pos) { return std::find(cells.begin(), cells.end(), pos) - cells.begin(); };
+    size_t n = cells.size(), h = at(e.head);
+    if (h == n) return false;
+
+    switch (o.tok) {
+        case brain::add:
+            e.b[h] += o.val;
+            break;
+        case brain::clear:
+            memset(e.a[h], 0, sizeof(e.a[h]));
+            e.b[h] = 0;
+            break;
+        case brain::mul: {
+            size_t t = at(e.head + o.off);
+            if (t == n || t == h) return false;
+
+            for (size_t i = 0; i < n; i++) e.a[t][i] += o.val * e.a[h][i];
+            e.b[t] += o.val * e.b[h];
+            break;
+        }
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+
+// ------------------------------------------------------------
+//  effect_of
+//
+//  What a whole run does, starting from the identity.
+// ------------------------------------------------------------
+static effect effect_of(const run& r, const std::vector<int64_t>& cells) {
+
+    effect e{};
+    for (size_t i = 0; i < cells.size(); i++) e.a[i][i] = 1;
+    for (const op& o : r) apply(e, o, cells);
+
+    return e;
+}
+
+
+// The search for a cheaper run, kept together so the recursion only has to pass what changes.
+class searcher {
+public:
+
+    searcher(const fragment& f, const effect& t): cells(f.cells), target(t) {
+
+        // Anywhere the head has to stop, the cells it works on and where it has to end up.
+        stops = cells;
+        if (std::find(stops.begin(), stops.end(), target.head) == stops.end()) stops.push_back(target.head);
+
+        // The amounts worth trying are those in the run and in it's effect.
+        std::set<int64_t> amounts;
+        for (const op& o : f.ops) if (o.tok == brain::add || o.tok == brain::mul) amounts.insert(wrap_cell(o.val));
+
+        for (size_t i = 0; i < cells.size(); i++) {
+            amounts.insert(wrap_cell(target.b[i]));
+            for (size_t j = 0; j < cells.size(); j++) if (i != j) amounts.insert(wrap_cell(target.a[i][j]));
+        }
+
+        amounts.erase(0);
+        consts.assign(amounts.begin(), amounts.end());
+    }
+
+    // Find the cheapest run with the target's effect, costing less than limit.
+    bool find(size_t limit, run& out) {
+
+        effect start = effect_of({}, cells);
+
+        for (size_t budget = 0; budget < limit; budget++) {
+            seq.clear();
+            if (dfs(start, budget)) {
+                out = seq;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private:
+
+    std::vector<int64_t> cells, stops, consts;
+    effect target;
+    run seq;
+
+    // Each op writes at most one cell and costs at least one, so every cell that's still wrong costs at least one more.
+    size_t lower_bound(const effect& e) {
+
+        size_t wrong = e.head != target.head;
+
+        for (size_t i = 0; i < cells.size(); i++) {
+            wrong += memcmp(e.a[i], target.a[i], sizeof(e.a[i])) || e.b[i] != target.b[i];
+        }
+
+        return wrong;
+    }
+
+    bool dfs(const effect& e, size_t left) {
+
+        // Every cheaper budget has already been tried, so anything found now costs exactly the budget.
+        if (e == target) return true;
+        if (lower_bound(e) > left) return false;
+
+        brain::token last = seq.empty() ? brain::nil : seq.back().tok;
+        bool at_cell = std::find(cells.begin(), cells.end(), e.head) != cells.end();
+
+        auto attempt = [&](op o) {
+            effect next = e;
+            if (cost(o) > left || !apply(next, o, cells)) return false;
+
+            seq.push_back(o);
+            if (dfs(next, left - cost(o))) return true;
+            seq.pop_back();
+
+            return false;
+        };
+
+        // Two moves in a row are one move, and an add or clear straight after an add could have been one op.
+        if (last != brain::move) {
+            for (int64_t p : stops) if (p != e.head && attempt({brain::move, p - e.head, 0})) return true;
+        }
+
+        if (!at_cell) return false;
+
+        if (last != brain::add) {
+            for (int64_t k : consts) if (attempt({brain::add, k, 0})) return true;
+        }
+
+        if (last != brain::add && last != brain::clear && attempt({brain::clear, 0, 0})) return true;
+
+        for (int64_t p : cells) {
+            if (p == e.head) continue;
+            for (int64_t k : consts) if (attempt({brain::mul, k, p - e.head})) return true;
+        }
+
+        return false;
+    }
+};
+
+
+// A run's op with the cells it works on already looked up, for running it over and over.
+struct cell_op {
+    brain::token tok;
+    uint8_t val;
+    size_t src, dst;
+};
+
+
+// ------------------------------------------------------------
+//  lower
+//
+//  Look up the cells each op works on, with the head starting
+//  at position 0.
+// ------------------------------------------------------------
+static std::vector<cell_op> lower(const run& r, const std::vector<int64_t>& cells) {
+
+    std::vector<cell_op> out;
+    int64_t head = 0;
+    auto at = [&](int64_t pos) { return (size_t) (std::find(cells.begin(), cells.end(), pos) - cells.begin()); };
+
+    for (const op& o : r) {
+        if (o.tok == brain::move) head += o.val;
+        else out.push_back({o.tok, (uint8_t) o.val, at(head), at(head + (o.tok == brain::mul ? o.off : 0))});
+    }
+
+    return out;
+}
+
+
+// ------------------------------------------------------------
+//  run_on
+//
+//  Run the lowered ops on a window of the tape.
+// ------------------------------------------------------------
+static void run_on(const std::vector<cell_op>& r, uint8_t* tape) {
+
+    for (const cell_op& o : r) {
+        switch (o.tok) {
+            case brain::add: tape[o.src] += o.val; break;
+            case brain::clear: tape[o.src] = 0; break;
+            case brain::mul: tape[o.dst] += tape[o.src] * o.val; break;
+            default: break;
+        }
+    }
+}
+
+
+// ------------------------------------------------------------
+//  prove
+//
+//  Check the two runs leave the same cells behind for every
+//  value of every cell they touch. The search only compares
+//  effects, this doesn't trust that they capture everything.
+// ------------------------------------------------------------
+static bool prove(const run& from, const run& to, const std::vector<int64_t>& cells) {
+
+    size_t n = cells.size();
+    uint64_t states = 1ull << (8 * n);
+
+    // Where the head ends up doesn't depend on the cells.
+    int64_t from_head = 0, to_head = 0;
+    for (const op& o : from) if (o.tok == brain::move) from_head += o.val;
+    for (const op& o : to) if (o.tok == brain::move) to_head += o.val;
+    if (from_head != to_head) return false;
+
+    std::vector<cell_op> x_ops = lower(from, cells), y_ops = lower(to, cells);
+
+    for (uint64_t s = 0; s < states; s++) {
+        uint8_t x[MAX_CELLS], y[MAX_CELLS];
+        for (size_t i = 0; i < n; i++) x[i] = y[i] = (uint8_t) (s >> (8 * i));
+
+        run_on(x_ops, x);
+        run_on(y_ops, y);
+
+        if (memcmp(x, y, n)) return false;
+    }
+
+    return true;
+}
+
+
+// ------------------------------------------------------------
+//  straight
+//
+//  Whether the op can be part of a straight run.
+// ------------------------------------------------------------
+static bool straight(const std::shared_ptr<ast>& t) {
+    return t->token == brain::add || t->token == brain::move || t->token == brain::clear || t->token == brain::mul;
+}
+
+
+// ------------------------------------------------------------
+//  collect
+//
+//  Gather every run of two to max_ops straight ops, touching
+//  at most max_cells cells, in the optimized tree.
+// ------------------------------------------------------------
+static void collect(const std::shared_ptr<ast>& t, const std::string& file, size_t max_ops, size_t max_cells,
+                    std::map<std::string, fragment>& frags) {
+
+    std::vector<std::shared_ptr<ast> > stack{t};
+
+    while (!stack.empty()) {
+        std::shared_ptr<ast> node = stack.back();
+        stack.pop_back();
+
+        std::vector<std::shared_ptr<ast> >& c = node->children;
+
+        for (size_t i = 0; i < c.size(); i++) {
+            if (c[i]->token == brain::loop || c[i]->token == brain::branch) stack.push_back(c[i]);
+
+            run r;
+
+            for (size_t j = i; j < c.size() && j - i < max_ops && straight(c[j]); j++) {
+                r.push_back({c[j]->token, c[j]->val, c[j]->off});
+
+                std::vector<int64_t> cells = touched(r);
+                if (cells.size() > max_cells) break;
+                if (r.size() < 2) continue;
+
+                fragment& f = frags[encode(r)];
+                f.ops = r, f.cells = cells;
+                f.seen++;
+                f.files.insert(file);
+            }
+        }
+    }
+}
+
+
+// ------------------------------------------------------------
+//  contains
+//
+//  Whether any shorter run inside r already has a rewrite. The
+//  optimizer applies the table until nothing changes, so the
+//  longer run would be redundant.
+// ------------------------------------------------------------
+static bool contains(const run& r, const std::set<std::string>& rewritten) {
+
+    for (size_t i = 0; i < r.size(); i++) {
+        for (size_t len = 2; i + len <= r.size() && len < r.size(); len++) {
+            if (rewritten.count(encode(run(r.begin() + i, r.begin() + i + len)))) return true;
+        }
+    }
+
+    return false;
+}
+
+
+// ------------------------------------------------------------
+//  write_table
+//
+//  Write the rewrites out as a header for the bf optimizer.
+// ------------------------------------------------------------
+static bool write_table(const std::string& path, const std::vector<found>& rewrites, size_t max_ops, size_t max_cells) {
+
+    std::ofstream ofs(path);
+
+    ofs << "// ------------------------------------------------------------\n"
+           "//  superopt_table.h\n"
+           "//\n"
+           "//  Rewrites for short straight runs of folded ops, each into\n"
+           "//  the cheapest run that leaves every cell it touches the\n"
+           "//  same. Written by bf-superopt, run the superopt target to\n"
+           "//  remake it rather than editing it by hand.\n"
+           "// ------------------------------------------------------------\n"
+           "\n"
+           "#pragma once\n"
+           "\n"
+           "\n"
+           "// Include statements.\n"
+           "#include <vector>\n"
+           "#include <cstdint>\n"
+           "#include <cstddef>\n"
+           "\n"
+           "#include \"util.h\"\n"
+           "\n"
+           "\n"
+           "namespace brain {\n"
+           "\n"
+           "    // Longest run in the table, and the most cells any of them touch.\n"
+           "    const size_t SUPEROPT_MAX_OPS = " << max_ops << ", SUPEROPT_MAX_CELLS = " << max_cells << ";\n"
+           "\n"
+           "    // A single op of a replacement.\n"
+           "    struct rewrite_op {\n"
+           "        token tok;\n"
+           "        int64_t val, off;\n"
+           "    };\n"
+           "\n"
+           "    // A run in the form brain::encode writes it, and the run that replaces it.\n"
+           "    struct rewrite {\n"
+           "        const char* from;\n"
+           "        std::vector<rewrite_op> to;\n"
+           "    };\n"
+           "\n"
+           "    const std::vector<rewrite> SUPEROPT_TABLE = {\n";
+
+    for (const found& f : rewrites) {
+        ofs << "        {\"" << f.from << "\", {";
+
+        for (size_t i = 0; i < f.to.size(); i++) {
+            ofs << (i ? ", " : "") << "{" << brain::token_name(f.to[i].tok) << ", " << f.to[i].val << ", " << f.to[i].off << "}";
+        }
+
+        ofs << "}},\n";
+    }
+
+    ofs << "    };\n"
+           "}\n";
+
+    return (bool) ofs;
+}
+
+
+int main(int argc, char** argv) {
+
+    size_t max_cells = 3, max_ops = 8;
+    std::string table;
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "-h" || arg == "--help") {
+            std::cout << USAGE << OPTIONS;
+            return 0;
+        }
+
+        if (arg.rfind("--cells=", 0) == 0) max_cells = std::clamp<size_t>(strtoull(value.c_str(), nullptr, 10), 1, MAX_CELLS);
+        else if (arg.rfind("--max-ops=", 0) == 0) max_ops = std::max<size_t>(strtoull(value.c_str(), nullptr, 10), 2);
+        else if (arg.rfind("--table=", 0) == 0) table = value;
+        else if (arg.rfind("-", 0) != 0) inputs.push_back(arg);
+        else {
+            std::cerr << "\x1B[31merror:\033[0m unknown option " << arg << "\n" << USAGE;
+            return 2;
+        }
+    }
+
+    if (inputs.empty()) {
+        std::cerr << "\x1B[31merror:\033[0m no input files\n" << USAGE;
+        return 2;
+    }
+
+    // Optimize each program the way brainc would, short of the table itself, and gather it's runs.
+    std::map<std::string, fragment> frags;
+    std::map<std::string, std::pair<size_t, size_t> > shipped;
+
+    for (const std::string& file : inputs) {
+        std::ifstream ifs(file);
+        std::stringstream prog;
+        prog << ifs.rdbuf();
+
+        if (!ifs) {
+            std::cerr << "\x1B[31merror:\033[0m can't read " << file << "\n";
+            return 1;
+        }
+
+        // Build it twice, so the table compiled in can be measured against the program without it.
+        std::shared_ptr<ast> trees[2];
+
+        for (int with = 0; with < 2; with++) {
+            ast_builder ast_pass(prog.str());
+            trees[with] = std::make_shared<ast>(brain::root);
+            ast_pass.visit(trees[with]);
+
+            if (ast_pass.ec != brain_errc::no_err) {
+                std::cerr << brain::err_msg(ast_pass.ec.message(), ast_pass.err_node);
+                return 1;
+            }
+
+            bf_optimizer opt_pass;
+            opt_pass.superopt = with;
+            opt_pass.visit(trees[with]);
+        }
+
+        std::string name = file.substr(file.find_last_of('/') + 1);
+        name = name.substr(0, name.find_last_of('.'));
+
+        shipped[name] = {brain::count_nodes(trees[0]), brain::count_nodes(trees[1])};
+        collect(trees[0], name, max_ops, max_cells, frags);
+    }
+
+    // Shortest runs first, so longer ones that only improve on a shorter run inside them can be skipped.
+    std::vector<const fragment*> order;
+    for (auto& f : frags) order.push_back(&f.second);
+
+    std::stable_sort(order.begin(), order.end(), [](const fragment* a, const fragment* b) { return a->ops.size() < b->ops.size(); });
+
+    std::vector<found> rewrites;
+    std::set<std::string> rewritten;
+    size_t searched = 0, unproven = 0;
+
+    for (const fragment* f : order) {
+        if (contains(f->ops, rewritten)) continue;
+
+        searched++;
+        effect target = effect_of(f->ops, f->cells);
+
+        run best;
+        if (!searcher(*f, target).find(cost(f->ops), best)) continue;
+
+        // The search is only as good as the effects, so nothing goes in the table without a proof.
+        if (!prove(f->ops, best, f->cells)) {
+            std::cerr << "\x1B[31merror:\033[0m couldn't prove " << encode(f->ops) << " -> " << encode(best) << "\n";
+            unproven++;
+            continue;
+        }
+
+        rewritten.insert(encode(f->ops));
+        rewrites.push_back({encode(f->ops), best, cost(f->ops) - cost(best), f->seen, f->files});
+    }
+
+    // Report what was found, the rewrites that save the most over the corpus first.
+    std::stable_sort(rewrites.begin(), rewrites.end(), [](const found& a, const found& b) {
+        return a.saved * a.seen > b.saved * b.seen;
+    });
+
+    size_t total = 0;
+    std::map<std::string, size_t> per_file;
+
+    printf("%-56s %-36s %6s %6s  %s\n", "run", "rewrite", "saves", "seen", "programs");
+
+    for (const found& f : rewrites) {
+        std::string files;
+        for (const std::string& file : f.files) files += (files.empty() ? "" : ",") + file, per_file[file] += f.saved * f.seen;
+
+        printf("%-56s %-36s %6zu %6zu  %s\n", f.from.c_str(), f.to.empty() ? "(nothing)" : encode(f.to).c_str(), f.saved, f.seen, files.c_str());
+        total += f.saved * f.seen;
+    }
+
+    printf("\n%zu runs, %zu searched, %zu rewrites found, %zu cheaper over the corpus, counting overlapping runs\n",
+           frags.size(), searched, rewrites.size(), total);
+
+    // What the table compiled into this build actually does to each program, rewrites applied until nothing changes.
+    printf("\n%-20s %10s %10s %10s %10s\n", "program", "found", "ops", "with table", "change");
+
+    for (auto& p : shipped) {
+        size_t before = p.second.first, after = p.second.second;
+        printf("%-20s %10zu %10zu %10zu %+9.1f%%\n", p.first.c_str(), per_file[p.first], before, after,
+               before ? (100.0 * after / before - 100) : 0.0);
+    }
+
+    // The table is sorted by run, so remaking it only changes the lines for rewrites that changed.
+    std::sort(rewrites.begin(), rewrites.end(), [](const found& a, const found& b) { return a.from < b.from; });
+
+    if (!table.empty() && !write_table(table, rewrites, max_ops, max_cells)) {
+        std::cerr << "\x1B[31merror:\033[0m can't write " << table << "\n";
+        return 1;
+    }
+
+    return unproven ? 1 : 0;
+}
@@ -0,0 +1,131 @@
+// ------------------------------------------------------------
+//  bf_writer.cpp
+//
+//  Writing the AST back out as bf.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <cassert>
+
+#include "util.h"
+#include "bf_writer.h"
+#include "bf_error.h"
+
+
+// ------------------------------------------------------------
+//  visit
+//
+//  General visit function for the writer. The folded tokens
+//  are written in the canonical form of their idiom.
+// ------------------------------------------------------------
+void bf_writer::visit(std::shared_ptr<ast>& t) {
+
+    // Make sure we aren't visiting a nil token in the AST.
+    if (brain::DEBUG) assert(t->token != brain::nil);
+
+    // Don't proceed if we've already hit an error.
+    if (ec != brain_errc::no_err) return;
+
+    switch (t->token) {
+        case brain::root: visit_children(t); break;
+        case brain::plus:
+        case brain::minus:
+        case brain::period:
+        case brain::comma:
+        case brain::larrow:
+        case brain::rarrow: prog += brain::token_name(t->token); break;
+        case brain::add: run(t->val, '+', '-'); break;
+        case brain::move: run(t->val, '>', '<'); break;
+        case brain::clear: prog += "[-]"; break;
+        case brain::scan:
+            prog += "[";
+            run(t->val, '>', '<');
+            prog += "]";
+            break;
+
+        // A branch's body ends on a zero cell, so as a loop it still only runs once.
+        case brain::loop:
+        case brain::branch:
+            prog += "[";
+            visit_children(t);
+            prog += "]";
+            break;
+        default:
+            t = std::make_shared<ast>(brain::nil);
+    }
+}
+
+
+// ------------------------------------------------------------
+//  visit_children
+//
+//  Write out each child in turn. The optimizer leaves a
+//  multiply loop as a mul for each target followed by a
+//  clear, which go back together as one loop counting down.
+// ------------------------------------------------------------
+void bf_writer::visit_children(std::shared_ptr<ast>& t) {
+
+    std::vector<std::shared_ptr<ast> >& children = t->children;
+
+    for (size_t i = 0; i < children.size(); i++) {
+        if (children[i]->token != brain::mul) {
+            visit(children[i]);
+            continue;
+        }
+
+        // Visit each target in turn, then head back to the counter.
+        int64_t off = 0;
+        prog += "[-";
+
+        for (; i < children.size() && children[i]->token == brain::mul; i++) {
+            run(children[i]->off - off, '>', '<');
+            run(children[i]->val, '+', '-');
+            off = children[i]->off;
+        }
+
+        run(-off, '>', '<');
+        prog += "]";
+
+        // The clear is part of the loop, since it counts the cell down to zero, so it's skipped. Muls that leave
+        // the counter as it was can't be written as a loop at all.
+        if (i >= children.size() || children[i]->token != brain::clear) {
+            ec = brain_errc::write_lone_mul;
+            return;
+        }
+    }
+}
+
+
+// ------------------------------------------------------------
+//  run
+//
+//  Write out a run of n tokens, up if positive, down if not.
+// ------------------------------------------------------------
+void bf_writer::run(int64_t n, char up, char down) {
+    prog.append(n < 0 ? -n : n, n < 0 ? down : up);
+}
+
+
+// ------------------------------------------------------------
+//  expected_steps
+//
+//  Each op is a step, and a folded run of n is n of them. A
+//  loop checks its cell on the way in, then runs the body
+//  and checks again on every pass, where a branch only makes
+//  the one pass.
+// ------------------------------------------------------------
+double bf_writer::expected_steps(const std::shared_ptr<ast>& t, double loop_trips) {
+
+    double inner = 0;
+    for (const std::shared_ptr<ast>& c : t->children) inner += expected_steps(c, loop_trips);
+
+    switch (t->token) {
+        case brain::root: return inner;
+        case brain::loop: return 1 + loop_trips * (inner + 1);
+        case brain::branch: return 1 + inner + 1;
+        case brain::add:
+        case brain::move: return t->val < 0 ? -t->val : t->val;
+        default: return 1;
+    }
+}
@@ -0,0 +1,52 @@
+// ------------------------------------------------------------
+//  brainc_client.cpp
+//
+//  Entry point for brainc-client, a stand in for brainc that
+//  has the compile server do the work. It doesn't load LLVM,
+//  so it starts in a fraction of the time brainc does.
+// ------------------------------------------------------------
+
+// Include statments.
+#include <iostream>
+#include <string>
+#include <vector>
+#include <filesystem>
+#include <system_error>
+#include <unistd.h>
+
+#include "cmd_parser.h"
+#include "bf_error.h"
+#include "server.h"
+
+
+int main(int argc, char** argv) {
+
+    // Initialize the command argument parser.
+    cmd_parser input(argc, argv);
+
+    std::string socket = input.option_exists("--socket") ? input.get_option("--socket") : brain::default_socket();
+    std::error_code ec;
+
+    int status = brain::forward(socket, input.for_server(), ec);
+    if (ec != brain_errc::cmd_no_server) {
+        if (ec) std::cerr << brain::err_msg(ec.message());
+        return status;
+    }
+
+    // Without a server, run the brainc installed alongside us instead. It's given the same arguments as the
+    // server would be, as --client would have it insist on a server too.
+    std::error_code exe_ec;
+    std::filesystem::path brainc = std::filesystem::read_symlink("/proc/self/exe", exe_ec).parent_path() / "brainc";
+
+    std::vector<std::string> local = input.for_server();
+    local[0] = brainc.string();
+
+    std::vector<char*> args;
+    for (std::string& a : local) args.push_back(a.data());
+    args.push_back(nullptr);
+
+    execv(args[0], args.data());
+
+    std::cerr << brain::err_msg(ec.message());
+    return 2;
+}
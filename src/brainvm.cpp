@@ -0,0 +1,81 @@
+// ------------------------------------------------------------
+//  brainvm.cpp
+//
+//  Entry point for the bytecode interpreter. Runs a bf program
+//  directly, without going through LLVM.
+// ------------------------------------------------------------
+
+// Include statments.
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <system_error>
+
+#include "util.h"
+#include "ast_builder.h"
+#include "bf_optimizer.h"
+#include "bytecode.h"
+#include "cmd_parser.h"
+#include "bf_error.h"
+#include "vm.h"
+
+
+static_assert(brain::VM_TAPE_SIZE == brain::CELL_SIZE, "the vm and compiled code should share a tape size");
+
+int main(int argc, char** argv) {
+
+    // Initialize the command argument parser.
+    cmd_parser input(argc, argv);
+
+    // Printing the help message takes priority over all other input arguments.
+    if (input.option_exists("-h") || input.option_exists("--help") || input.option_exists("help")) {
+        std::cout << brain::VERSION << std::endl << brain::VM_USAGE << brain::VM_OPTIONS << std::endl;
+        return 0;
+    }
+
+    // Print the version and exit.
+    if (input.option_exists("-v") || input.option_exists("--version")) {
+        std::cout << brain::VERSION;
+        return 0;
+    }
+
+    // Make sure at least the input file is given, and that it is a valid file.
+    if (!input.check_input_file()) {
+        std::cerr << brain::err_msg(input.ec.message());
+        std::cerr << brain::VM_USAGE;
+        return 2;
+    }
+
+    // Read in the file.
+    std::ifstream ifs(input.get_input_file());
+    std::stringstream bf_prog;
+    bf_prog << ifs.rdbuf();
+
+    // Build the AST.
+    ast_builder ast_pass(bf_prog.str());
+    std::shared_ptr<ast> tree = std::make_shared<ast>(brain::root);
+    ast_pass.visit(tree);
+
+    if (ast_pass.ec != brain_errc::no_err) {
+        std::cerr << brain::err_msg(ast_pass.ec.message(), ast_pass.err_node);
+        return 1;
+    }
+
+    // Fold runs and idioms into superinstructions, unless asked not to.
+    if (input.get_opt_level() > 0) {
+        bf_optimizer opt_pass;
+        opt_pass.visit(tree);
+    }
+
+    // Generate the bytecode and run it.
+    bytecode_gen byte_pass;
+    byte_pass.visit(tree);
+
+    std::vector<uint8_t> tape(brain::CELL_SIZE, 0);
+    brain::vm_run(byte_pass.code.data(), tape.data());
+
+    return 0;
+}
@@ -0,0 +1,198 @@
+// ------------------------------------------------------------
+//  budget.cpp
+//
+//  The estimate is a cost model fitted to timings of LLVM's
+//  passes and codegen on generated and real programs. After
+//  the bf optimizer, time spent optimizing a function grows
+//  with it's size times it's number of loops, as the loop
+//  passes keep revisiting the whole function, which is why
+//  outlining into smaller functions helps so much. It only
+//  has to be good enough to tell the plans apart.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "budget.h"
+#include "util.h"
+
+
+// Costs in ms. Optimizing is per op, plus per op per loop in the same function, and a bit less at -O1. At -O0
+// there are no loop passes, and hardly anything else runs.
+static const double OPT_PER_OP = 0.021;
+static const double OPT_PER_LOOP_OP = 0.00035;
+static const double OPT_O1_SCALE = 0.75;
+static const double OPT_O0_SCALE = 0.05;
+
+// The light pipeline has the same shape, but is much cheaper.
+static const double LIGHT_PER_OP = 0.006;
+static const double LIGHT_PER_LOOP_OP = 0.00009;
+
+// Codegen is per op, plus per loop. Fully optimized code in main is the cheapest to compile, since the tape
+// and index are locals there. Otherwise what's left after the light pipeline is bigger.
+static const double CODEGEN_PER_OP = 0.005;
+static const double OUTLINED_CODEGEN_PER_OP = 0.028;
+static const double LIGHT_CODEGEN_PER_OP = 0.042;
+static const double LIGHT_OUTLINED_CODEGEN_PER_OP = 0.026;
+static const double CODEGEN_PER_LOOP = 0.6;
+
+// Bytecode is only copied into the object, and everything has a fixed cost for setting up the passes and target.
+static const double BYTECODE_PER_OP = 0.0005;
+static const double FIXED_MS = 10;
+
+
+// A function the program is compiled into, by the number of ops and loops in it.
+struct fn_shape {
+    size_t ops = 0, loops = 0;
+};
+
+
+// ------------------------------------------------------------
+//  count_loops
+//
+//  Count the loops left in the program after the bf optimizer.
+// ------------------------------------------------------------
+size_t brain::count_loops(const std::shared_ptr<ast>& t) {
+
+    size_t cnt = t->token == brain::loop;
+    for (auto child : t->children) cnt += brain::count_loops(child);
+
+    return cnt;
+}
+
+
+// ------------------------------------------------------------
+//  split_functions
+//
+//  Gather the top level into functions the same way the code
+//  gen pass does when outlining, with what's left over at the
+//  end going into main.
+// ------------------------------------------------------------
+static std::vector<fn_shape> split_functions(const std::shared_ptr<ast>& root, bool outline) {
+
+    std::vector<fn_shape> fns;
+    fn_shape run;
+
+    for (const std::shared_ptr<ast>& c : root->children) {
+        run.ops += brain::count_nodes(c) + 1;
+        run.loops += brain::count_loops(c);
+
+        if (outline && run.ops >= brain::OUTLINE_SIZE) {
+            fns.push_back(run);
+            run = fn_shape();
+        }
+    }
+
+    fns.push_back(run);
+    return fns;
+}
+
+
+// ------------------------------------------------------------
+//  name
+//
+//  The level, then how the program is laid out.
+// ------------------------------------------------------------
+std::string brain::compile_plan::name() const {
+
+    if (bytecode) return "bytecode";
+
+    std::string n = light ? "light" : "O" + std::to_string(opt_level);
+    return outline ? n + "+outline" : n;
+}
+
+
+// ------------------------------------------------------------
+//  estimate_compile_ms
+//
+//  Functions are spread over the threads when there's more
+//  than one of them, but the biggest can't be split.
+// ------------------------------------------------------------
+double brain::estimate_compile_ms(const std::shared_ptr<ast>& root, const compile_plan& plan, size_t threads) {
+
+    if (plan.bytecode) return FIXED_MS + BYTECODE_PER_OP * brain::count_nodes(root);
+
+    double scale = plan.opt_level >= 2 ? 1 : plan.opt_level == 1 ? OPT_O1_SCALE : OPT_O0_SCALE;
+    double total = 0, biggest = 0;
+
+    std::vector<fn_shape> fns = split_functions(root, plan.outline);
+
+    for (size_t i = 0; i < fns.size(); i++) {
+        double ops = fns[i].ops, loops = fns[i].loops;
+
+        // Only the last function is main, the rest are outlined.
+        bool outlined = plan.outline && i + 1 < fns.size();
+        double ms = CODEGEN_PER_LOOP * loops;
+
+        if (plan.light) {
+            ms += LIGHT_PER_OP * ops + LIGHT_PER_LOOP_OP * ops * loops;
+            ms += (outlined ? LIGHT_OUTLINED_CODEGEN_PER_OP : LIGHT_CODEGEN_PER_OP) * ops;
+        } else {
+            ms += scale * (OPT_PER_OP * ops + OPT_PER_LOOP_OP * ops * loops);
+            ms += (outlined ? OUTLINED_CODEGEN_PER_OP : CODEGEN_PER_OP) * ops;
+        }
+
+        total += ms, biggest = std::max(biggest, ms);
+    }
+
+    if (threads > 1 && fns.size() > 1) total = std::max(total / std::min(threads, fns.size()), biggest);
+
+    return FIXED_MS + total;
+}
+
+
+// ------------------------------------------------------------
+//  plan_compile
+//
+//  Outlining changes the least about the output, so it's
+//  tried before dropping the level. A plan expected to take
+//  longer than the one asked for is never picked, so -O0 has
+//  no use for the light pipeline.
+// ------------------------------------------------------------
+brain::compile_plan brain::plan_compile(const std::shared_ptr<ast>& root, int opt_level, bool outline, size_t threads, double budget_ms,
+                                        bool native) {
+
+    std::vector<compile_plan> plans;
+
+    auto add = [&](int level, bool light, bool out) {
+        compile_plan p;
+        p.opt_level = level, p.light = light, p.outline = out;
+        plans.push_back(p);
+    };
+
+    add(opt_level, false, outline);
+    if (!outline) add(opt_level, false, true);
+
+    for (int level = opt_level - 1; level >= 1; level--) add(level, false, true);
+
+    if (opt_level > 0) {
+        add(1, true, false);
+        add(1, true, true);
+    }
+
+    for (compile_plan& p : plans) p.estimate_ms = estimate_compile_ms(root, p, threads);
+
+    double requested_ms = plans[0].estimate_ms;
+
+    plans.erase(std::remove_if(plans.begin(), plans.end(), [&](const compile_plan& p) { return p.estimate_ms > requested_ms; }), plans.end());
+
+    for (const compile_plan& p : plans) {
+        if (p.estimate_ms <= budget_ms) return p;
+    }
+
+    if (native) {
+        return *std::min_element(plans.begin(), plans.end(), [](const compile_plan& a, const compile_plan& b) {
+            return a.estimate_ms < b.estimate_ms;
+        });
+    }
+
+    compile_plan p;
+    p.opt_level = opt_level, p.bytecode = true;
+    p.estimate_ms = estimate_compile_ms(root, p, threads);
+
+    return p;
+}
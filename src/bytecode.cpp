@@ -0,0 +1,123 @@
+// ------------------------------------------------------------
+//  bytecode.cpp
+//
+//  Bytecode generation for the bf virtual machine.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <cassert>
+
+#include "util.h"
+#include "bytecode.h"
+#include "bf_error.h"
+
+
+// ------------------------------------------------------------
+//  visit
+//
+//  General visit function for bytecode generation.
+// ------------------------------------------------------------
+void bytecode_gen::visit(std::shared_ptr<ast>& t) {
+
+    // Make sure we aren't visiting a nil token in the AST.
+    if (brain::DEBUG) assert(t->token != brain::nil);
+
+    // Don't proceed if we've already hit an error.
+    if (ec != brain_errc::no_err) return;
+
+    // Most tokens are a single instruction.
+    switch (t->token) {
+        case brain::root: visit_root(t); break;
+        case brain::loop:
+        case brain::branch: visit_loop(t); break;
+        case brain::plus: emit(brain::op_add, 1); break;
+        case brain::minus: emit(brain::op_add, -1); break;
+        case brain::rarrow: emit(brain::op_move, 1); break;
+        case brain::larrow: emit(brain::op_move, -1); break;
+        case brain::period: emit(brain::op_out); break;
+        case brain::comma: emit(brain::op_in); break;
+        case brain::add: emit(brain::op_add, t->val); break;
+        case brain::move: emit(brain::op_move, t->val); break;
+        case brain::clear: emit(brain::op_clear); break;
+        case brain::mul: emit(brain::op_mul, t->off, t->val); break;
+        case brain::scan: emit(brain::op_scan, t->val); break;
+        default:
+            t = std::make_shared<ast>(brain::nil);
+    }
+}
+
+
+// ------------------------------------------------------------
+//  visit_root
+//
+//  Generate the whole program, followed by a halt.
+// ------------------------------------------------------------
+void bytecode_gen::visit_root(std::shared_ptr<ast>& t) {
+
+    // Make sure our token is the root.
+    if (brain::DEBUG) assert(t->token == brain::root);
+
+    code.clear();
+    for (std::shared_ptr<ast> c : t->children) visit(c);
+
+    emit(brain::op_halt);
+}
+
+
+// ------------------------------------------------------------
+//  visit_loop
+//
+//  Generate a loop as a jz/jnz pair. Each jumps to the
+//  instruction just past the other. Branches are the same,
+//  just without the jump back.
+// ------------------------------------------------------------
+void bytecode_gen::visit_loop(std::shared_ptr<ast>& t) {
+
+    // Emit the forward jump, and patch it once we know where the loop ends.
+    size_t start = code.size();
+    emit(brain::op_jz);
+    size_t body = code.size();
+
+    for (std::shared_ptr<ast> c : t->children) visit(c);
+
+    if (t->token == brain::loop) emit(brain::op_jnz, body);
+    put(start + 1, code.size(), 4);
+}
+
+
+// ------------------------------------------------------------
+//  emit
+//
+//  Append a single instruction to the program. See vm.h for
+//  the operands of each opcode.
+// ------------------------------------------------------------
+void bytecode_gen::emit(brain::opcode op, int64_t a, int64_t b) {
+
+    code.push_back(op);
+
+    // Values wrap the same way the cells and head do, so truncating is safe.
+    switch (op) {
+        case brain::op_add: put(code.size(), a, 1); break;
+        case brain::op_move:
+        case brain::op_scan: put(code.size(), a, 2); break;
+        case brain::op_jz:
+        case brain::op_jnz: put(code.size(), a, 4); break;
+        case brain::op_mul: put(code.size(), a, 2), put(code.size(), b, 1); break;
+        default: break;
+    }
+}
+
+
+// ------------------------------------------------------------
+//  put
+//
+//  Write a little endian operand, either over an existing one
+//  or onto the end of the program.
+// ------------------------------------------------------------
+void bytecode_gen::put(size_t pos, uint64_t val, size_t bytes) {
+
+    if (pos == code.size()) code.resize(code.size() + bytes);
+
+    for (size_t i = 0; i < bytes; i++) code[pos + i] = val >> (8 * i) & 0xff;
+}
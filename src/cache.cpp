@@ -0,0 +1,329 @@
+// ------------------------------------------------------------
+//  cache.cpp
+//
+//  Entries are stored as objects/<key>, and are written to a
+//  temporary name first then renamed into place, so readers
+//  never see half an entry. The counters and eviction share a
+//  lock file, so concurrent brainc processes stay consistent.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <system_error>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Support/SHA1.h"
+
+#include "cache.h"
+
+
+namespace fs = std::filesystem;
+
+
+// ------------------------------------------------------------
+//  temp_name
+//
+//  A temporary name next to path that no other writer uses.
+//  The process id keeps processes apart, and the counter the
+//  threads in the same process, which can be writing the same
+//  key at once.
+// ------------------------------------------------------------
+static std::string temp_name(const fs::path& path) {
+
+    static std::atomic<uint64_t> next{0};
+    return path.string() + ".tmp." + std::to_string(getpid()) + "." + std::to_string(next++);
+}
+
+
+// ------------------------------------------------------------
+//  key
+//
+//  SHA1 of the parts. Each is length prefixed, so no two
+//  different lists hash the same input.
+// ------------------------------------------------------------
+std::string brain::compile_cache::key(const std::vector<std::string>& parts) {
+
+    llvm::SHA1 hash;
+
+    for (const std::string& p : parts) {
+        hash.update(std::to_string(p.size()) + ":");
+        hash.update(p);
+    }
+
+    return llvm::toHex(hash.final(), true);
+}
+
+
+// ------------------------------------------------------------
+//  fetch
+//
+//  Copy an entry out, and touch it so it counts as recently
+//  used.
+// ------------------------------------------------------------
+bool brain::compile_cache::fetch(const std::string& key, const std::string& output_file) {
+
+    fs::path entry = fs::path(dir) / "objects" / key;
+    std::string tmp = temp_name(output_file);
+    std::error_code ec;
+
+    // Copy next to the output and rename over it, so a failed copy leaves the old output alone.
+    bool hit = fs::copy_file(entry, tmp, fs::copy_options::overwrite_existing, ec);
+    if (hit) fs::rename(tmp, output_file, ec);
+
+    if (ec) {
+        fs::remove(tmp, ec);
+        hit = false;
+    } else {
+        fs::last_write_time(entry, fs::file_time_type::clock::now(), ec);
+    }
+
+    count(hit);
+    return hit;
+}
+
+
+// ------------------------------------------------------------
+//  load
+//
+//  Read an entry into memory, and touch it.
+// ------------------------------------------------------------
+bool brain::compile_cache::load(const std::string& key, std::string& data) {
+
+    fs::path entry = fs::path(dir) / "objects" / key;
+    std::ifstream ifs(entry, std::ios::binary);
+    bool hit = false;
+
+    if (ifs) {
+        data.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        hit = !ifs.bad();
+
+        std::error_code ec;
+        fs::last_write_time(entry, fs::file_time_type::clock::now(), ec);
+    }
+
+    count(hit);
+    return hit;
+}
+
+
+// ------------------------------------------------------------
+//  insert
+//
+//  Add an entry, then evict until the cache fits the limit.
+// ------------------------------------------------------------
+void brain::compile_cache::insert(const std::string& key, const std::string& output_file) {
+
+    fs::path objects = fs::path(dir) / "objects";
+    std::string tmp = temp_name(objects / key);
+    std::error_code ec;
+
+    fs::create_directories(objects, ec);
+    fs::copy_file(output_file, tmp, fs::copy_options::overwrite_existing, ec);
+
+    if (ec) {
+        fs::remove(tmp, ec);
+        return;
+    }
+
+    add_entry(key, tmp);
+}
+
+
+// ------------------------------------------------------------
+//  store
+//
+//  Add an entry from memory.
+// ------------------------------------------------------------
+void brain::compile_cache::store(const std::string& key, const std::string& data) {
+
+    fs::path objects = fs::path(dir) / "objects";
+    std::string tmp = temp_name(objects / key);
+    std::error_code ec;
+
+    fs::create_directories(objects, ec);
+
+    {
+        std::ofstream ofs(tmp, std::ios::binary);
+        ofs.write(data.data(), data.size());
+        if (!ofs) ec = std::make_error_code(std::errc::io_error);
+    }
+
+    if (ec) {
+        fs::remove(tmp, ec);
+        return;
+    }
+
+    add_entry(key, tmp);
+}
+
+
+// ------------------------------------------------------------
+//  add_entry
+//
+//  Rename the finished temporary file into place, then evict
+//  until the cache fits the limit.
+// ------------------------------------------------------------
+void brain::compile_cache::add_entry(const std::string& key, const std::string& tmp) {
+
+    fs::path objects = fs::path(dir) / "objects";
+    std::error_code ec;
+
+    // Rename is atomic, if another process inserted the same key first one of the identical entries just wins.
+    fs::rename(tmp, objects / key, ec);
+
+    if (ec) {
+        fs::remove(tmp, ec);
+        return;
+    }
+
+    int fd = lock();
+    if (fd < 0) return;
+
+    // Gather the finished entries, oldest first.
+    std::vector<std::pair<fs::file_time_type, fs::path> > entries;
+    uint64_t total = 0;
+
+    for (const fs::directory_entry& e : fs::directory_iterator(objects, ec)) {
+        if (e.path().filename().string().find(".tmp.") != std::string::npos) continue;
+
+        total += e.file_size(ec);
+        entries.push_back({e.last_write_time(ec), e.path()});
+    }
+
+    std::sort(entries.begin(), entries.end());
+
+    // Always keep the newest entry, even if it's over the limit on it's own.
+    for (size_t i = 0; i + 1 < entries.size() && total > limit; i++) {
+        total -= fs::file_size(entries[i].second, ec);
+        fs::remove(entries[i].second, ec);
+    }
+
+    unlock(fd);
+}
+
+
+// ------------------------------------------------------------
+//  read_counters
+//
+//  Load the counters, and count the entries and their size.
+// ------------------------------------------------------------
+void brain::compile_cache::read_counters(uint64_t& entries, uint64_t& bytes) {
+
+    std::error_code ec;
+    entries = bytes = 0;
+
+    int fd = lock();
+    if (fd < 0) return;
+
+    load_counters();
+
+    for (const fs::directory_entry& e : fs::directory_iterator(fs::path(dir) / "objects", ec)) {
+        if (e.path().filename().string().find(".tmp.") != std::string::npos) continue;
+        entries++, bytes += e.file_size(ec);
+    }
+
+    unlock(fd);
+}
+
+
+// ------------------------------------------------------------
+//  count
+//
+//  Bump the hit or miss counter, under the lock.
+// ------------------------------------------------------------
+void brain::compile_cache::count(bool hit) {
+
+    int fd = lock();
+    if (fd < 0) return;
+
+    load_counters();
+    (hit ? hits : misses)++;
+    save_counters();
+
+    unlock(fd);
+}
+
+
+// ------------------------------------------------------------
+//  lock / unlock
+//
+//  An exclusive flock on <dir>/lock.
+// ------------------------------------------------------------
+int brain::compile_cache::lock() {
+
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+
+    int fd = open((fs::path(dir) / "lock").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd >= 0 && flock(fd, LOCK_EX) != 0) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+void brain::compile_cache::unlock(int fd) {
+    flock(fd, LOCK_UN);
+    close(fd);
+}
+
+
+// ------------------------------------------------------------
+//  load_counters / save_counters
+//
+//  The counters are kept in <dir>/stats as "hits <n>" and
+//  "misses <n>" lines.
+// ------------------------------------------------------------
+void brain::compile_cache::load_counters() {
+
+    std::ifstream ifs(fs::path(dir) / "stats");
+    std::string name;
+    uint64_t val;
+
+    hits = misses = 0;
+
+    while (ifs >> name >> val) {
+        if (name == "hits") hits = val;
+        else if (name == "misses") misses = val;
+    }
+}
+
+void brain::compile_cache::save_counters() {
+
+    std::string tmp = (fs::path(dir) / "stats.tmp").string();
+    std::error_code ec;
+
+    {
+        std::ofstream ofs(tmp);
+        ofs << "hits " << hits << "\nmisses " << misses << "\n";
+    }
+
+    fs::rename(tmp, fs::path(dir) / "stats", ec);
+}
+
+
+// ------------------------------------------------------------
+//  default_cache_dir
+//
+//  Follow the XDG convention, unless told otherwise.
+// ------------------------------------------------------------
+std::string brain::default_cache_dir() {
+
+    if (const char* env = getenv("BRAINC_CACHE_DIR")) return env;
+    if (const char* xdg = getenv("XDG_CACHE_HOME")) return (fs::path(xdg) / "brainc").string();
+    if (const char* home = getenv("HOME")) return (fs::path(home) / ".cache" / "brainc").string();
+
+    return (fs::temp_directory_path() / "brainc-cache").string();
+}
@@ -13,6 +13,10 @@
 #include <algorithm>
 #include <stdexcept>
 #include <filesystem>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
 
 #include "cmd_parser.h"
 #include "util.h"
@@ -26,6 +30,11 @@
 // ------------------------------------------------------------
 bool cmd_parser::option_exists(const std::string& opt) {
 
+    // Value options match on the part before the '='.
+    if (arg_values.count(opt)) {
+        return std::any_of(args.begin(), args.end(), [&](const std::string& a) { return a.rfind(opt + "=", 0) == 0; });
+    }
+
     // Retrieve an iterator to the given option using std::find.
     auto it = std::find(args.begin(), args.end(), opt);
 
@@ -41,6 +50,15 @@ bool cmd_parser::option_exists(const std::string& opt) {
 // ------------------------------------------------------------
 std::string cmd_parser::get_option(const std::string& opt) {
 
+    // Value options return whatever comes after the '='.
+    if (arg_values.count(opt)) {
+        for (const std::string& a : args) {
+            if (a.rfind(opt + "=", 0) == 0) return a.substr(opt.length() + 1);
+        }
+
+        return "";
+    }
+
     // Retrieve an iterator to the given option using std::find.
     auto it = std::find(args.begin(), args.end(), opt);
 
@@ -51,6 +69,22 @@ std::string cmd_parser::get_option(const std::string& opt) {
 }
 
 
+// ------------------------------------------------------------
+//  is_input
+//
+//  Check if an argument is an input file. We ignore arguments
+//  that have an option parameter preceeding them.
+// ------------------------------------------------------------
+bool cmd_parser::is_input(size_t i) {
+
+    return !arg_flags.count(args[i])
+           && !arg_parameters.count(args[i])
+           && !arg_optimization.count(args[i])
+           && !arg_values.count(args[i].substr(0, args[i].find('=')))
+           && !arg_parameters.count(args[i - 1]);
+}
+
+
 // ------------------------------------------------------------
 //  get_input_file
 //
@@ -59,14 +93,8 @@ std::string cmd_parser::get_option(const std::string& opt) {
 std::string cmd_parser::get_input_file() {
 
     // Loop through every argument.
-    // We ignore arguments that have an option parameter preceeding them.
     for (size_t i = 1; i < args.size(); i++) {
-        if (!arg_flags.count(args[i])
-            && !arg_optimization.count(args[i])
-            && !arg_parameters.count(args[i - 1])) {
-            
-            return args[i];
-        }
+        if (is_input(i)) return args[i];
     }
 
     // Otherwise, return an empty string.
@@ -74,6 +102,62 @@ std::string cmd_parser::get_input_file() {
 }
 
 
+// ------------------------------------------------------------
+//  get_input_files
+//
+//  Get all of the input files, in order.
+// ------------------------------------------------------------
+std::vector<std::string> cmd_parser::get_input_files() {
+
+    std::vector<std::string> files;
+
+    for (size_t i = 1; i < args.size(); i++) {
+        if (is_input(i)) files.push_back(args[i]);
+    }
+
+    return files;
+}
+
+
+// ------------------------------------------------------------
+//  for_input
+//
+//  Keep the options that apply to every file, and add the
+//  given input and output.
+// ------------------------------------------------------------
+cmd_parser cmd_parser::for_input(const std::string& file, const std::string& output) {
+
+    std::vector<std::string> file_args{args[0]};
+
+    for (size_t i = 1; i < args.size(); i++) {
+        if (is_input(i) || arg_parameters.count(args[i - 1])) continue;
+        if (batch_only.count(args[i].substr(0, args[i].find('=')))) continue;
+
+        file_args.push_back(args[i]);
+    }
+
+    file_args.insert(file_args.end(), {file, "-o", output});
+    return cmd_parser(file_args);
+}
+
+
+// ------------------------------------------------------------
+//  for_server
+//
+//  Keep everything but the client options, inputs included.
+// ------------------------------------------------------------
+std::vector<std::string> cmd_parser::for_server() {
+
+    std::vector<std::string> server_args;
+
+    for (const std::string& a : args) {
+        if (!client_only.count(a.substr(0, a.find('=')))) server_args.push_back(a);
+    }
+
+    return server_args;
+}
+
+
 // ------------------------------------------------------------
 //  check_input_file
 // 
@@ -95,6 +179,48 @@ bool cmd_parser::check_input_file() {
 }
 
 
+// ------------------------------------------------------------
+//  check_values
+// 
+//  Checks the whole number options are only digits, and fit
+//  in 64 bits, the cache size in bytes too, and that the
+//  budget is a number of ms.
+// ------------------------------------------------------------
+bool cmd_parser::check_values() {
+
+    for (const std::string& opt : arg_counts) {
+        if (!option_exists(opt)) continue;
+
+        std::string val = get_option(opt);
+        bool digits = !val.empty() && std::all_of(val.begin(), val.end(), [](char c) { return c >= '0' && c <= '9'; });
+
+        errno = 0;
+        unsigned long long n = digits ? std::strtoull(val.c_str(), nullptr, 10) : 0;
+
+        // The cache size is in MiB, and used in bytes.
+        bool too_big = errno == ERANGE || (opt == "--cache-size" && n > UINT64_MAX >> 20);
+
+        if (!digits || too_big) {
+            ec = brain_errc::cmd_bad_value;
+            bad_value = opt + "=" + val;
+        }
+    }
+
+    if (option_exists("--compile-budget")) {
+        std::string val = get_option("--compile-budget");
+        char* end = nullptr;
+        double ms = std::strtod(val.c_str(), &end);
+
+        if (val.empty() || *end != '\0' || !std::isfinite(ms) || ms < 0) {
+            ec = brain_errc::cmd_bad_value;
+            bad_value = "--compile-budget=" + val;
+        }
+    }
+
+    return ec == brain_errc::no_err;
+}
+
+
 // ------------------------------------------------------------
 //  get_opt_level
 // 
@@ -7,9 +7,13 @@
 
 // Include statements.
 #include <cassert>
+#include <cctype>
 #include <iostream>
 #include <vector>
 #include <string>
+#include <algorithm>
+#include <numeric>
+#include <mutex>
 
 #include "llvm/IR/IRBuilder.h"
 #include "llvm/IR/LLVMContext.h"
@@ -18,6 +22,13 @@
 #include "llvm/IR/Constants.h"
 #include "llvm/IR/Type.h"
 #include "llvm/IR/Function.h"
+#include "llvm/IR/GlobalVariable.h"
+#include "llvm/IR/DIBuilder.h"
+#include "llvm/IR/DebugInfoMetadata.h"
+#include "llvm/IR/MDBuilder.h"
+#include "llvm/IR/ProfileSummary.h"
+#include "llvm/ProfileData/ProfileCommon.h"
+#include "llvm/BinaryFormat/Dwarf.h"
 #include "llvm/IR/Verifier.h"
 #include "llvm/IR/DataLayout.h"
 #include "llvm/ADT/Triple.h"
@@ -31,6 +42,7 @@
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Host.h"
 #include "llvm/Support/Alignment.h"
+#include "llvm/Support/Path.h"
 #include "llvm/Analysis/TargetLibraryInfo.h"
 
 #include "code_gen.h"
@@ -52,12 +64,16 @@ bool code_gen::initialize_module() {
     // Create a new builder for the module.
     builder = std::make_unique<llvm::IRBuilder<> >(*ctx);
 
-    // Initialize all targets.
-    llvm::InitializeAllTargetInfos();
-    llvm::InitializeAllTargets();
-    llvm::InitializeAllTargetMCs();
-    llvm::InitializeAllAsmParsers();
-    llvm::InitializeAllAsmPrinters();
+    // Initialize all targets, only once per process since batch mode has many code gen passes.
+    static std::once_flag init_targets;
+
+    std::call_once(init_targets, [] {
+        llvm::InitializeAllTargetInfos();
+        llvm::InitializeAllTargets();
+        llvm::InitializeAllTargetMCs();
+        llvm::InitializeAllAsmParsers();
+        llvm::InitializeAllAsmPrinters();
+    });
 
     // Set the target triple and target machine.
     auto triple = llvm::sys::getDefaultTargetTriple();
@@ -73,16 +89,44 @@ bool code_gen::initialize_module() {
     auto rm = llvm::Optional<llvm::Reloc::Model>();
 
     // Set the machine.
-    machine = std::unique_ptr<llvm::TargetMachine>(target->createTargetMachine(triple, llvm::sys::getHostCPUName(), "", {}, llvm::Reloc::PIC_));
+    std::string cpu_name = cpu.empty() ? llvm::sys::getHostCPUName().str() : cpu;
+    machine = std::unique_ptr<llvm::TargetMachine>(target->createTargetMachine(triple, cpu_name, features, {}, llvm::Reloc::PIC_));
 
     // Set the layout and target triple.
     mod->setDataLayout(machine->createDataLayout());
     mod->setTargetTriple(triple);
 
+    init_debug_info();
+
     return true;
 }
 
 
+// ------------------------------------------------------------
+//  init_debug_info
+// 
+//  Set up the compile unit for the bf source file, if we're
+//  emitting debug info.
+// ------------------------------------------------------------
+void code_gen::init_debug_info() {
+
+    if (!debug_info) return;
+
+    // Debuggers want the directory and file name separately.
+    llvm::SmallString<256> path(prog_name);
+    llvm::sys::fs::make_absolute(path);
+
+    dbuilder = std::make_unique<llvm::DIBuilder>(*mod);
+    dfile = dbuilder->createFile(llvm::sys::path::filename(path), llvm::sys::path::parent_path(path));
+
+    // There's no DWARF language code for bf, C is the closest thing tools understand.
+    dbuilder->createCompileUnit(llvm::dwarf::DW_LANG_C, dfile, "Big Brain Compiler", false, "", 0);
+
+    mod->addModuleFlag(llvm::Module::Warning, "Debug Info Version", llvm::DEBUG_METADATA_VERSION);
+    mod->addModuleFlag(llvm::Module::Warning, "Dwarf Version", 4);
+}
+
+
 // ------------------------------------------------------------
 //  visit
 // 
@@ -96,6 +140,15 @@ void code_gen::visit(std::shared_ptr<ast>& t) {
     // Don't proceed if we've already hit an error.
     if (ec != brain_errc::no_err) return;
 
+    // Everything generated for this node maps back to it's position in the source.
+    set_location(t);
+
+    // Cold copies of a loop that's found elsewhere too are a call, rather than being generated again.
+    if (shared.count(t.get()) && t.get() != sharing) {
+        visit_shared(t);
+        return;
+    }
+
     // Reduce into each of the possible cases.
     switch (t->token) {
         case brain::plus:
@@ -122,6 +175,24 @@ void code_gen::visit(std::shared_ptr<ast>& t) {
         case brain::loop:
             visit_loop(t);
             break;
+        case brain::add:
+            visit_add(t);
+            break;
+        case brain::move:
+            visit_move(t);
+            break;
+        case brain::clear:
+            visit_clear(t);
+            break;
+        case brain::mul:
+            visit_mul(t);
+            break;
+        case brain::scan:
+            visit_scan(t);
+            break;
+        case brain::branch:
+            visit_branch(t);
+            break;
         default:
             t = std::make_shared<ast>(brain::nil);
     }
@@ -138,27 +209,202 @@ void code_gen::visit_root(std::shared_ptr<ast>& t) {
     // Make sure our token is the root.
     if (brain::DEBUG) assert(t->token == brain::root);
 
-    // Initialize the main function, and its return value.
+    // Initialize the main function, and its return value. In ABI mode it takes the tape and I/O instead.
     llvm::FunctionType* main_ty = llvm::FunctionType::get(builder->getInt32Ty(), std::vector<llvm::Type*>{}, false);
-    llvm::Function* main = llvm::Function::Create(main_ty, llvm::Function::ExternalLinkage, "main", *mod);
+
+    if (!abi_name.empty()) {
+        main_ty = llvm::FunctionType::get(builder->getInt32Ty(), {builder->getInt8PtrTy(), mod->getDataLayout().getIntPtrType(*ctx),
+                                                                  llvm::PointerType::getUnqual(io_type())}, false);
+    }
+
+    llvm::Function* main = llvm::Function::Create(main_ty, llvm::Function::ExternalLinkage, abi_name.empty() ? "main" : "bf_" + abi_name, *mod);
+
+    // Give main a subprogram, so everything inside it can refer back to the source.
+    if (dbuilder) {
+        llvm::DISubroutineType* sub_ty = dbuilder->createSubroutineType(dbuilder->getOrCreateTypeArray({}));
+        llvm::DISubprogram* sp = dbuilder->createFunction(dfile, main->getName(), "", dfile, 1, sub_ty, 1,
+                                                          llvm::DINode::FlagPrototyped, llvm::DISubprogram::SPFlagDefinition);
+        main->setSubprogram(sp);
+        scopes.push_back(sp);
+        set_location(t);
+    }
 
     // Initialize the entry basic block for main.
     llvm::BasicBlock *entry = llvm::BasicBlock::Create(*ctx, "entry", main);
     builder->SetInsertPoint(entry);
+    init_profile_use(main);
+
+    // Initialize the index and cell array, which the caller owns in ABI mode.
+    if (!abi_name.empty()) {
+        init_abi(main);
+    } else {
+        idx = builder->CreateAlloca(builder->getInt16Ty(), 0, "idx");
+        builder->CreateStore(builder->getInt16(0), idx);
+
+        llvm::ArrayType* cell_ty = llvm::ArrayType::get(builder->getInt8Ty(), brain::CELL_SIZE);
+        cell = builder->CreateAlloca(cell_ty, 0, "cell");
+        builder->CreateMemSet(cell, builder->getInt8(0), builder->getInt32(brain::CELL_SIZE), llvm::MaybeAlign(0));
+    }
 
-    // Initialize the index and cell array.
-    idx = builder->CreateAlloca(builder->getInt16Ty(), 0, "idx");
-    builder->CreateStore(builder->getInt16(0), idx);
+    declare_debug_vars();
+    init_profile(t);
+    init_steps(main, true);
+    init_shared(t);
 
-    llvm::ArrayType* cell_ty = llvm::ArrayType::get(builder->getInt8Ty(), brain::CELL_SIZE);
-    cell = builder->CreateAlloca(cell_ty, 0, "cell");
-    builder->CreateMemSet(cell, builder->getInt8(0), builder->getInt32(brain::CELL_SIZE), llvm::MaybeAlign(0));
+    // Loop through visiting all of the root's children, gathering them up into functions when outlining.
+    std::vector<std::shared_ptr<ast> > run;
+    size_t run_size = 0;
 
-    // Loop through visiting all of the root's children.
-    for (std::shared_ptr<ast> c : t->children) visit(c);
+    for (std::shared_ptr<ast> c : t->children) {
+        if (!outline_size) {
+            visit(c);
+            continue;
+        }
+
+        run.push_back(c);
+        run_size += brain::count_nodes(c) + 1;
+
+        if (run_size >= outline_size) {
+            visit_outlined(run);
+            run.clear(), run_size = 0;
+        }
+    }
+
+    for (std::shared_ptr<ast> c : run) visit(c);
 
     // Create the return statement and validate the generated code.
     builder->CreateRet(builder->getInt32(0));
+    if (dbuilder) dbuilder->finalize();
+
+    llvm::verifyFunction(*main, &llvm::errs());
+}
+
+
+// ------------------------------------------------------------
+//  visit_bytecode
+// 
+//  Embed the bytecode as a constant array, and generate a main
+//  that runs it with brain_rt_run from the runtime library.
+// ------------------------------------------------------------
+void code_gen::visit_bytecode(const std::vector<uint8_t>& code) {
+
+    // A private constant, so it ends up in .rodata.
+    llvm::Constant* data = llvm::ConstantDataArray::get(*ctx, llvm::ArrayRef<uint8_t>(code));
+    llvm::GlobalVariable* blob = new llvm::GlobalVariable(*mod, data->getType(), true, llvm::GlobalValue::PrivateLinkage, data, "bytecode");
+    blob->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+
+    // Initialize the main function, which just calls into the runtime.
+    llvm::FunctionType* main_ty = llvm::FunctionType::get(builder->getInt32Ty(), std::vector<llvm::Type*>{}, false);
+    llvm::Function* main = llvm::Function::Create(main_ty, llvm::Function::ExternalLinkage, "main", *mod);
+
+    llvm::BasicBlock *entry = llvm::BasicBlock::Create(*ctx, "entry", main);
+    builder->SetInsertPoint(entry);
+
+    llvm::FunctionCallee run = mod->getOrInsertFunction("brain_rt_run", builder->getInt32Ty(), builder->getInt8PtrTy());
+    llvm::Value* start = builder->CreateConstInBoundsGEP2_64(data->getType(), blob, 0, 0, "code");
+
+    builder->CreateRet(builder->CreateCall(run, start, "run"));
+    llvm::verifyFunction(*main, &llvm::errs());
+}
+
+
+// ------------------------------------------------------------
+//  visit_dispatch
+// 
+//  Ask the runtime for the CPU's level, then check it against
+//  each variant's, highest first.
+// ------------------------------------------------------------
+void code_gen::visit_dispatch(const std::vector<std::pair<int, std::string> >& variants) {
+
+    llvm::FunctionType* main_ty = llvm::FunctionType::get(builder->getInt32Ty(), std::vector<llvm::Type*>{}, false);
+    llvm::Function* main = llvm::Function::Create(main_ty, llvm::Function::ExternalLinkage, "main", *mod);
+
+    builder->SetInsertPoint(llvm::BasicBlock::Create(*ctx, "entry", main));
+
+    llvm::FunctionCallee cpu_level = mod->getOrInsertFunction("brain_rt_cpu_level", builder->getInt32Ty());
+    llvm::Value* level = builder->CreateCall(cpu_level, {}, "level");
+
+    for (auto it = variants.rbegin(); it != variants.rend(); it++) {
+        llvm::BasicBlock* run = llvm::BasicBlock::Create(*ctx, "run", main);
+        llvm::BasicBlock* next = llvm::BasicBlock::Create(*ctx, "next", main);
+
+        builder->CreateCondBr(builder->CreateICmpSGE(level, builder->getInt32(it->first), "supported"), run, next);
+
+        builder->SetInsertPoint(run);
+        llvm::FunctionCallee variant = mod->getOrInsertFunction(it->second, main_ty);
+        builder->CreateRet(builder->CreateCall(variant, {}, "ret"));
+
+        builder->SetInsertPoint(next);
+    }
+
+    // Not even the lowest level is supported, so say so rather than crash on an illegal instruction.
+    llvm::FunctionCallee unsupported = mod->getOrInsertFunction("brain_rt_cpu_unsupported", builder->getInt32Ty(), builder->getInt32Ty());
+    builder->CreateRet(builder->CreateCall(unsupported, {builder->getInt32(variants.front().first)}, "ret"));
+
+    llvm::verifyFunction(*main, &llvm::errs());
+}
+
+
+// ------------------------------------------------------------
+//  visit_executor
+// 
+//  brain_rt_exec takes the program along with main's own
+//  arguments, and runs as many copies of it as it's asked to.
+// ------------------------------------------------------------
+void code_gen::visit_executor() {
+
+    llvm::Type* argv_ty = llvm::PointerType::getUnqual(builder->getInt8PtrTy());
+    llvm::FunctionType* main_ty = llvm::FunctionType::get(builder->getInt32Ty(), {builder->getInt32Ty(), argv_ty}, false);
+    llvm::Function* main = llvm::Function::Create(main_ty, llvm::Function::ExternalLinkage, "main", *mod);
+
+    builder->SetInsertPoint(llvm::BasicBlock::Create(*ctx, "entry", main));
+
+    llvm::Function* program = mod->getFunction("bf_" + abi_name);
+    llvm::FunctionCallee exec = mod->getOrInsertFunction("brain_rt_exec", builder->getInt32Ty(), program->getType(), builder->getInt32Ty(), argv_ty);
+
+    builder->CreateRet(builder->CreateCall(exec, {program, main->getArg(0), main->getArg(1)}, "ret"));
+    llvm::verifyFunction(*main, &llvm::errs());
+}
+
+
+// ------------------------------------------------------------
+//  visit_bundle
+// 
+//  Tables of the programs' names and mains, as constants so
+//  they're shared read only, handed to brain_rt_bundle along
+//  with main's own arguments.
+// ------------------------------------------------------------
+void code_gen::visit_bundle(const std::vector<std::pair<std::string, std::string> >& programs) {
+
+    llvm::Type* argv_ty = llvm::PointerType::getUnqual(builder->getInt8PtrTy());
+    llvm::FunctionType* prog_ty = llvm::FunctionType::get(builder->getInt32Ty(), std::vector<llvm::Type*>{}, false);
+    llvm::FunctionType* main_ty = llvm::FunctionType::get(builder->getInt32Ty(), {builder->getInt32Ty(), argv_ty}, false);
+    llvm::Function* main = llvm::Function::Create(main_ty, llvm::Function::ExternalLinkage, "main", *mod);
+
+    builder->SetInsertPoint(llvm::BasicBlock::Create(*ctx, "entry", main));
+
+    std::vector<llvm::Constant*> names, mains;
+
+    for (const auto& p : programs) {
+        names.push_back(builder->CreateGlobalStringPtr(p.first, "name"));
+        mains.push_back(llvm::cast<llvm::Constant>(mod->getOrInsertFunction(p.second, prog_ty).getCallee()));
+    }
+
+    llvm::ArrayType* names_ty = llvm::ArrayType::get(builder->getInt8PtrTy(), names.size());
+    llvm::ArrayType* mains_ty = llvm::ArrayType::get(prog_ty->getPointerTo(), mains.size());
+
+    auto* name_table = new llvm::GlobalVariable(*mod, names_ty, true, llvm::GlobalValue::PrivateLinkage, llvm::ConstantArray::get(names_ty, names), "names");
+    auto* main_table = new llvm::GlobalVariable(*mod, mains_ty, true, llvm::GlobalValue::PrivateLinkage, llvm::ConstantArray::get(mains_ty, mains), "mains");
+
+    llvm::FunctionCallee bundle = mod->getOrInsertFunction("brain_rt_bundle", builder->getInt32Ty(), llvm::PointerType::getUnqual(builder->getInt8PtrTy()),
+                                                           llvm::PointerType::getUnqual(prog_ty->getPointerTo()), builder->getInt32Ty(),
+                                                           builder->getInt32Ty(), argv_ty);
+
+    llvm::Value* args[] = {builder->CreateConstInBoundsGEP2_64(names_ty, name_table, 0, 0, "names"),
+                           builder->CreateConstInBoundsGEP2_64(mains_ty, main_table, 0, 0, "mains"),
+                           builder->getInt32(programs.size()), main->getArg(0), main->getArg(1)};
+
+    builder->CreateRet(builder->CreateCall(bundle, args, "ret"));
     llvm::verifyFunction(*main, &llvm::errs());
 }
 
@@ -196,6 +442,18 @@ void code_gen::visit_minus(std::shared_ptr<ast>& t) {
 // ------------------------------------------------------------
 void code_gen::visit_period(std::shared_ptr<ast>& t) {
 
+    // In ABI mode, output goes to io->write(io->user, cell).
+    if (io) {
+        llvm::FunctionType* write_ty = llvm::FunctionType::get(builder->getVoidTy(), {builder->getInt8PtrTy(), builder->getInt8Ty()}, false);
+
+        llvm::Value* user = builder->CreateLoad(builder->getInt8PtrTy(), builder->CreateStructGEP(io_type(), io, 0), "user");
+        llvm::Value* write = builder->CreateLoad(llvm::PointerType::getUnqual(write_ty), builder->CreateStructGEP(io_type(), io, 2), "write");
+
+        llvm::CallInst* call = builder->CreateCall(write_ty, write, {user, get_cell()});
+        call->addParamAttr(1, llvm::Attribute::ZExt);
+        return;
+    }
+
     // Initialize the function callee for putchar.
     llvm::FunctionCallee putchar = mod->getOrInsertFunction("putchar", builder->getInt32Ty(), builder->getInt32Ty());
 
@@ -216,7 +474,21 @@ void code_gen::visit_comma(std::shared_ptr<ast>& t) {
     llvm::FunctionCallee getchar = mod->getOrInsertFunction("getchar", builder->getInt32Ty());
 
     // Call getchar and then truncate to 8 bits.
-    llvm::Value* call = builder->CreateCall(getchar, {}, "getchar_func");
+    if (profile) profile_count(prof_hist, builder->CreateZExt(builder->CreateLoad(idx, "load"), builder->getInt64Ty(), "zext"));
+    llvm::Value* call;
+
+    // In ABI mode, input comes from io->read(io->user).
+    if (io) {
+        llvm::FunctionType* read_ty = llvm::FunctionType::get(builder->getInt32Ty(), {builder->getInt8PtrTy()}, false);
+
+        llvm::Value* user = builder->CreateLoad(builder->getInt8PtrTy(), builder->CreateStructGEP(io_type(), io, 0), "user");
+        llvm::Value* read = builder->CreateLoad(llvm::PointerType::getUnqual(read_ty), builder->CreateStructGEP(io_type(), io, 1), "read");
+
+        call = builder->CreateCall(read_ty, read, {user}, "read_func");
+    } else {
+        call = builder->CreateCall(getchar, {}, "getchar_func");
+    }
+
     llvm::Value* new_val = builder->CreateTrunc(call, builder->getInt8Ty(), "trunc");
     set_cell(new_val);
 }
@@ -261,8 +533,9 @@ void code_gen::visit_rarrow(std::shared_ptr<ast>& t) {
 // ------------------------------------------------------------
 void code_gen::visit_loop(std::shared_ptr<ast>& t) {
 
-    // First retrieve the function.
+    // First retrieve the function, and number the loop.
     llvm::Function* main = builder->GetInsertBlock()->getParent();
+    size_t id = loop_cnt++;
 
     // Declare the condition, body, loop and join point basic blocks.
     llvm::BasicBlock* cond = llvm::BasicBlock::Create(*ctx, "cond", main);
@@ -270,19 +543,30 @@ void code_gen::visit_loop(std::shared_ptr<ast>& t) {
     llvm::BasicBlock* join = llvm::BasicBlock::Create(*ctx, "join");
 
     // Add in a branch from the current BB to the condition BB for fall-through.
+    if (profile) profile_count(prof_counts, builder->getInt64(2 * id));
     builder->CreateBr(cond);
 
     // Move the builder to the condition BB and set the comparison.
     builder->SetInsertPoint(cond);
     llvm::Value* cmp = builder->CreateICmpNE(get_cell(), builder->getInt8(0), "cmp");
-    builder->CreateCondBr(cmp, body, join);
+    llvm::BranchInst* cond_br = builder->CreateCondBr(cmp, body, join);
 
-    // Move the builder and recursively visit the children of the loop.
+    // Move the builder and recursively visit the children of the loop, each loop is it's own lexical block.
     builder->SetInsertPoint(body);
+    if (profile) profile_count(prof_counts, builder->getInt64(2 * id + 1));
+    if (dbuilder) scopes.push_back(dbuilder->createLexicalBlock(scopes.back(), dfile, t->line + 1, t->chr + 1));
+
     for (std::shared_ptr<ast> c : t->children) visit(c);
 
+    if (dbuilder) scopes.pop_back();
+    set_location(t);
+
+    // Each pass through the body is charged for it's ops in one go, nested loops charge for their own.
+    charge_steps(t->children.size() + 1);
+
     // Once we are done, we fall through to the cond BB.
-    builder->CreateBr(cond);
+    llvm::BranchInst* latch = builder->CreateBr(cond);
+    annotate_loop(t, cond_br, latch);
 
     // Now we insert the join point and finish the loop code generation.
     main->getBasicBlockList().push_back(join);
@@ -291,19 +575,382 @@ void code_gen::visit_loop(std::shared_ptr<ast>& t) {
 
 
 // ------------------------------------------------------------
-//  get_cell
+//  visit_add
 // 
-//  Get and return the llvm::Value for the current cell.
+//  Visit a folded run of +/-, adding it's total to the cell.
 // ------------------------------------------------------------
-llvm::Value* code_gen::get_cell() {
+void code_gen::visit_add(std::shared_ptr<ast>& t) {
 
-    // First load the index, then get the ptr for cell[idx].
-    llvm::Value* idx_val = builder->CreateLoad(idx, "load");
+    // The amount wraps the same way the cell does.
+    set_cell(builder->CreateAdd(get_cell(), builder->getInt8(t->val), "add"));
+}
+
+
+// ------------------------------------------------------------
+//  visit_move
+// 
+//  Visit a folded run of </>, moving the index by it's total.
+// ------------------------------------------------------------
+void code_gen::visit_move(std::shared_ptr<ast>& t) {
+
+    llvm::Value* idx_val = builder->CreateLoad(builder->getInt16Ty(), idx, "load");
+    builder->CreateStore(builder->CreateAdd(idx_val, builder->getInt16(t->val), "move"), idx);
+}
+
+
+// ------------------------------------------------------------
+//  visit_clear
+// 
+//  Visit a clear loop, e.g. [-], and zero the current cell.
+// ------------------------------------------------------------
+void code_gen::visit_clear(std::shared_ptr<ast>& t) {
+    set_cell(builder->getInt8(0));
+}
+
+
+// ------------------------------------------------------------
+//  visit_mul
+// 
+//  Visit one target of a multiply loop, adding the current
+//  cell times val to the cell at off.
+// ------------------------------------------------------------
+void code_gen::visit_mul(std::shared_ptr<ast>& t) {
+
+    llvm::Value* prod = builder->CreateMul(get_cell(), builder->getInt8(t->val), "mul");
+    set_cell(builder->CreateAdd(get_cell(t->off), prod, "add"), t->off);
+}
+
+
+// ------------------------------------------------------------
+//  visit_scan
+// 
+//  Visit a scan loop, e.g. [>], moving the index by val until
+//  it lands on a zero cell.
+// ------------------------------------------------------------
+void code_gen::visit_scan(std::shared_ptr<ast>& t) {
+
+    llvm::Function* main = builder->GetInsertBlock()->getParent();
+
+    llvm::BasicBlock* cond = llvm::BasicBlock::Create(*ctx, "scan_cond", main);
+    llvm::BasicBlock* body = llvm::BasicBlock::Create(*ctx, "scan_body", main);
+    llvm::BasicBlock* join = llvm::BasicBlock::Create(*ctx, "scan_join", main);
+
+    builder->CreateBr(cond);
+    builder->SetInsertPoint(cond);
+    builder->CreateCondBr(builder->CreateICmpNE(get_cell(), builder->getInt8(0), "cmp"), body, join);
+
+    builder->SetInsertPoint(body);
+    visit_move(t);
+    charge_steps(1);
+    builder->CreateBr(cond);
+
+    builder->SetInsertPoint(join);
+}
+
+
+// ------------------------------------------------------------
+//  visit_branch
+// 
+//  Visit a loop the optimizer found runs at most once, which
+//  is just an if statement.
+// ------------------------------------------------------------
+void code_gen::visit_branch(std::shared_ptr<ast>& t) {
+
+    llvm::Function* main = builder->GetInsertBlock()->getParent();
+
+    llvm::BasicBlock* body = llvm::BasicBlock::Create(*ctx, "then", main);
+    llvm::BasicBlock* join = llvm::BasicBlock::Create(*ctx, "join");
+
+    builder->CreateCondBr(builder->CreateICmpNE(get_cell(), builder->getInt8(0), "cmp"), body, join);
+    builder->SetInsertPoint(body);
+
+    if (dbuilder) scopes.push_back(dbuilder->createLexicalBlock(scopes.back(), dfile, t->line + 1, t->chr + 1));
+
+    for (std::shared_ptr<ast> c : t->children) visit(c);
+
+    if (dbuilder) scopes.pop_back();
+    set_location(t);
+
+    builder->CreateBr(join);
+
+    main->getBasicBlockList().push_back(join);
+    builder->SetInsertPoint(join);
+}
+
+
+// ------------------------------------------------------------
+//  visit_outlined
+// 
+//  Generate the nodes as an internal function, and call it.
+// ------------------------------------------------------------
+void code_gen::visit_outlined(std::vector<std::shared_ptr<ast> >& nodes) {
+
+    llvm::Function* fn = outline(nodes, "outlined", llvm::Function::InternalLinkage);
+
+    llvm::Value* head = builder->CreateCall(fn, {cell, builder->CreateLoad(builder->getInt16Ty(), idx, "load")}, "head");
+    builder->CreateStore(head, idx);
+}
+
+
+// ------------------------------------------------------------
+//  visit_shared
+// 
+//  Generate the loop as an internal function the first time
+//  it's shape comes up, and call it. It's kept out of line
+//  and small, since only the cold copies call it.
+// ------------------------------------------------------------
+void code_gen::visit_shared(std::shared_ptr<ast>& t) {
+
+    llvm::Function*& fn = shared_by_shape[t->shape];
+
+    if (!fn) {
+        std::vector<std::shared_ptr<ast> > nodes{t};
+        const ast* caller_sharing = sharing;
+
+        sharing = t.get();
+        fn = outline(nodes, "shared", llvm::Function::InternalLinkage);
+        sharing = caller_sharing;
+
+        fn->addFnAttr(llvm::Attribute::NoInline);
+        fn->addFnAttr(llvm::Attribute::OptimizeForSize);
+        shared_fns++;
+    }
+
+    llvm::Value* head = builder->CreateCall(fn, {cell, builder->CreateLoad(builder->getInt16Ty(), idx, "load")}, "head");
+    builder->CreateStore(head, idx);
+}
+
+
+// ------------------------------------------------------------
+//  visit_region
+// 
+//  Generate the nodes as the only function in the module, for
+//  an --incremental build.
+// ------------------------------------------------------------
+void code_gen::visit_region(std::vector<std::shared_ptr<ast> >& nodes, const std::string& name) {
+
+    outline(nodes, name, llvm::Function::ExternalLinkage);
+}
+
+
+// ------------------------------------------------------------
+//  visit_regions
+// 
+//  Generate a main that calls each region's function in turn,
+//  threading the tape and head through them.
+// ------------------------------------------------------------
+void code_gen::visit_regions(const std::vector<std::string>& names) {
+
+    llvm::FunctionType* main_ty = llvm::FunctionType::get(builder->getInt32Ty(), std::vector<llvm::Type*>{}, false);
+    llvm::Function* main = llvm::Function::Create(main_ty, llvm::Function::ExternalLinkage, "main", *mod);
+
+    builder->SetInsertPoint(llvm::BasicBlock::Create(*ctx, "entry", main));
+
+    idx = builder->CreateAlloca(builder->getInt16Ty(), 0, "idx");
+    builder->CreateStore(builder->getInt16(0), idx);
 
     llvm::ArrayType* cell_ty = llvm::ArrayType::get(builder->getInt8Ty(), brain::CELL_SIZE);
-    llvm::Value* gep = builder->CreateGEP(cell_ty, cell, {builder->getInt64(0), idx_val}, "gep");
+    cell = builder->CreateAlloca(cell_ty, 0, "cell");
+    builder->CreateMemSet(cell, builder->getInt8(0), builder->getInt32(brain::CELL_SIZE), llvm::MaybeAlign(0));
+
+    for (const std::string& name : names) {
+        llvm::FunctionCallee fn = mod->getOrInsertFunction(name, region_type());
+
+        llvm::Value* head = builder->CreateCall(fn, {cell, builder->CreateLoad(builder->getInt16Ty(), idx, "load")}, "head");
+        builder->CreateStore(head, idx);
+    }
+
+    builder->CreateRet(builder->getInt32(0));
+    llvm::verifyFunction(*main, &llvm::errs());
+}
+
+
+// ------------------------------------------------------------
+//  region_type
+// 
+//  Outlined functions take the tape and head, and return the
+//  new head.
+// ------------------------------------------------------------
+llvm::FunctionType* code_gen::region_type() {
+
+    llvm::Type* tape_ty = llvm::PointerType::getUnqual(llvm::ArrayType::get(builder->getInt8Ty(), brain::CELL_SIZE));
+    return llvm::FunctionType::get(builder->getInt16Ty(), {tape_ty, builder->getInt16Ty()}, false);
+}
+
+
+// ------------------------------------------------------------
+//  init_abi
+// 
+//  The head wraps at CELL_SIZE whatever the tape's length, so
+//  a shorter tape can't be used at all.
+// ------------------------------------------------------------
+void code_gen::init_abi(llvm::Function* fn) {
+
+    llvm::BasicBlock* too_short = llvm::BasicBlock::Create(*ctx, "too_short", fn);
+    llvm::BasicBlock* body = llvm::BasicBlock::Create(*ctx, "body", fn);
+
+    // The head's alloca has to be in the entry block to be promoted to a register.
+    idx = builder->CreateAlloca(builder->getInt16Ty(), 0, "idx");
+    builder->CreateStore(builder->getInt16(0), idx);
+
+    llvm::Value* len = fn->getArg(1);
+    builder->CreateCondBr(builder->CreateICmpULT(len, llvm::ConstantInt::get(len->getType(), brain::CELL_SIZE), "short"), too_short, body);
+
+    builder->SetInsertPoint(too_short);
+    builder->CreateRet(builder->getInt32(-1));
+
+    builder->SetInsertPoint(body);
+
+    llvm::Type* tape_ty = llvm::PointerType::getUnqual(llvm::ArrayType::get(builder->getInt8Ty(), brain::CELL_SIZE));
+    cell = builder->CreateBitCast(fn->getArg(0), tape_ty, "tape");
+    io = fn->getArg(2);
+}
+
+
+// ------------------------------------------------------------
+//  io_type
+// 
+//  struct bf_io { void* user; int (*read)(void*);
+//  void (*write)(void*, uint8_t); }, see abi_header.
+// ------------------------------------------------------------
+llvm::StructType* code_gen::io_type() {
+
+    if (io_ty) return io_ty;
+
+    llvm::Type* i8_ptr = builder->getInt8PtrTy();
+    llvm::FunctionType* read_ty = llvm::FunctionType::get(builder->getInt32Ty(), {i8_ptr}, false);
+    llvm::FunctionType* write_ty = llvm::FunctionType::get(builder->getVoidTy(), {i8_ptr, builder->getInt8Ty()}, false);
+
+    io_ty = llvm::StructType::create(*ctx, {i8_ptr, llvm::PointerType::getUnqual(read_ty), llvm::PointerType::getUnqual(write_ty)}, "struct.bf_io");
+    return io_ty;
+}
+
+
+// ------------------------------------------------------------
+//  abi_header
+// 
+//  The bf_io struct and BF_OUT_OF_STEPS are guarded
+//  separately, so the headers of several programs can be
+//  included together.
+// ------------------------------------------------------------
+std::string code_gen::abi_header(const std::string& name, const std::string& source_name, uint64_t step_budget) {
+
+    std::string guard = "BF_" + name + "_H";
+    for (char& c : guard) c = toupper(c);
+
+    std::string steps, steps_doc;
+
+    if (step_budget) {
+        steps = "/* Returned by a program that ran out of steps. */\n"
+                "#ifndef BF_OUT_OF_STEPS\n"
+                "#define BF_OUT_OF_STEPS " + std::to_string(brain::STEP_EXIT) + "\n"
+                "#endif\n"
+                "\n";
+        steps_doc = "\n   Returns BF_OUT_OF_STEPS instead once it's taken " + std::to_string(step_budget) + " steps through loops, after the output so far.";
+    }
+
+    return "/* Generated by brainc from " + source_name + ". */\n"
+           "#ifndef " + guard + "\n"
+           "#define " + guard + "\n"
+           "\n"
+           "#include <stddef.h>\n"
+           "#include <stdint.h>\n"
+           "\n"
+           "#ifdef __cplusplus\n"
+           "extern \"C\" {\n"
+           "#endif\n"
+           "\n"
+           "#ifndef BF_IO_DEFINED\n"
+           "#define BF_IO_DEFINED\n"
+           "\n"
+           "/* Cells a tape needs, the head wraps around from the last to the first. */\n"
+           "#define BF_TAPE_SIZE " + std::to_string(brain::CELL_SIZE) + "\n"
+           "\n"
+           "/* Where a program's input comes from and it's output goes. read returns the next byte, or -1 when there's\n"
+           "   no more, and write is given each byte output. Both are called with user, and neither may be null. */\n"
+           "typedef struct bf_io {\n"
+           "    void* user;\n"
+           "    int (*read)(void* user);\n"
+           "    void (*write)(void* user, uint8_t c);\n"
+           "} bf_io;\n"
+           "\n"
+           "#endif\n"
+           "\n"
+           + steps +
+           "/* Run the program with the head starting on the first cell of tape, which must have at least BF_TAPE_SIZE\n"
+           "   cells. Returns 0, or -1 if the tape is too short. Any number of threads can run it at once on their own tapes."
+           + steps_doc + " */\n"
+           "int bf_" + name + "(uint8_t* tape, size_t len, bf_io* io);\n"
+           "\n"
+           "#ifdef __cplusplus\n"
+           "}\n"
+           "#endif\n"
+           "\n"
+           "#endif\n";
+}
+
+
+// ------------------------------------------------------------
+//  outline
+// 
+//  Generate the nodes as a function of their own, leaving the
+//  builder where it was. The head is kept in an alloca within
+//  the function, so it's promoted to a register just like in
+//  main.
+// ------------------------------------------------------------
+llvm::Function* code_gen::outline(std::vector<std::shared_ptr<ast> >& nodes, const std::string& name, llvm::GlobalValue::LinkageTypes linkage) {
+
+    llvm::Function* fn = llvm::Function::Create(region_type(), linkage, name, *mod);
+
+    // Nothing else can reach the tape while the function runs.
+    fn->addParamAttr(0, llvm::Attribute::NoAlias);
+    fn->addParamAttr(0, llvm::Attribute::NoCapture);
+
+    llvm::IRBuilderBase::InsertPoint caller = builder->saveIP();
+    llvm::DebugLoc caller_loc = builder->getCurrentDebugLocation();
+    llvm::Value* caller_idx = idx, *caller_cell = cell;
+    llvm::BasicBlock* caller_out = out_of_steps;
+
+    // Then generate the body, with it's own subprogram so it still maps back to the source.
+    if (dbuilder) {
+        llvm::DISubroutineType* sub_ty = dbuilder->createSubroutineType(dbuilder->getOrCreateTypeArray({}));
+        llvm::DISubprogram* sp = dbuilder->createFunction(dfile, fn->getName(), "", dfile, nodes.front()->line + 1, sub_ty, nodes.front()->line + 1,
+                                                          llvm::DINode::FlagPrototyped, llvm::DISubprogram::SPFlagDefinition | llvm::DISubprogram::SPFlagLocalToUnit);
+        fn->setSubprogram(sp);
+        scopes.push_back(sp);
+        set_location(nodes.front());
+    }
+
+    builder->SetInsertPoint(llvm::BasicBlock::Create(*ctx, "entry", fn));
+
+    cell = fn->getArg(0);
+    idx = builder->CreateAlloca(builder->getInt16Ty(), 0, "idx");
+    builder->CreateStore(fn->getArg(1), idx);
+    init_steps(fn, false);
+
+    for (std::shared_ptr<ast>& c : nodes) visit(c);
+
+    builder->CreateRet(builder->CreateLoad(builder->getInt16Ty(), idx, "load"));
+    llvm::verifyFunction(*fn, &llvm::errs());
 
-    return builder->CreateLoad(gep, "cell");
+    if (dbuilder) scopes.pop_back();
+
+    // And pick up where we left off.
+    idx = caller_idx, cell = caller_cell, out_of_steps = caller_out;
+    builder->restoreIP(caller);
+    builder->SetCurrentDebugLocation(caller_loc);
+
+    return fn;
+}
+
+
+// ------------------------------------------------------------
+//  get_cell
+// 
+//  Get and return the llvm::Value for the current cell.
+// ------------------------------------------------------------
+llvm::Value* code_gen::get_cell(int64_t off) {
+    return builder->CreateLoad(builder->getInt8Ty(), cell_ptr(off, profile), "cell");
 }
 
 
@@ -312,17 +959,325 @@ llvm::Value* code_gen::get_cell() {
 // 
 //  Set the current cell to the given value.
 // ------------------------------------------------------------
-void code_gen::set_cell(llvm::Value* val) {
+void code_gen::set_cell(llvm::Value* val, int64_t off) {
     
     // Make sure that the given value is an i8 value.
     if (brain::DEBUG) assert(val->getType() == builder->getInt8Ty());
 
-    // Then, load the index and get the ptr.
-    llvm::Value* idx_val = builder->CreateLoad(idx, "load");
+    // Set the new cell value.
+    builder->CreateStore(val, cell_ptr(off));
+}
+
+
+// ------------------------------------------------------------
+//  cell_ptr
+// 
+//  Get the ptr for cell[idx + off], wrapping around the tape.
+//  Reads count as accesses when profiling.
+// ------------------------------------------------------------
+llvm::Value* code_gen::cell_ptr(int64_t off, bool count) {
+
+    // First load the index, offset it in 16 bits so it wraps, then zero extend it since it's unsigned.
+    llvm::Value* idx_val = builder->CreateLoad(builder->getInt16Ty(), idx, "load");
+    if (off) idx_val = builder->CreateAdd(idx_val, builder->getInt16(off), "offset");
+    idx_val = builder->CreateZExt(idx_val, builder->getInt64Ty(), "zext");
+
+    if (count) profile_count(prof_hist, idx_val);
 
     llvm::ArrayType* cell_ty = llvm::ArrayType::get(builder->getInt8Ty(), brain::CELL_SIZE);
-    llvm::Value* gep = builder->CreateGEP(cell_ty, cell, {builder->getInt64(0), idx_val}, "gep");
+    return builder->CreateGEP(cell_ty, cell, {builder->getInt64(0), idx_val}, "gep");
+}
 
-    // Set the new cell value.
-    builder->CreateStore(val, gep);
+
+// ------------------------------------------------------------
+//  declare_debug_vars
+// 
+//  Describe the head and tape to the debugger, so they can be
+//  inspected as "head" and "tape".
+// ------------------------------------------------------------
+void code_gen::declare_debug_vars() {
+
+    if (!dbuilder) return;
+
+    llvm::DIScope* sp = scopes.front();
+    llvm::DIType* head_ty = dbuilder->createBasicType("unsigned short", 16, llvm::dwarf::DW_ATE_unsigned);
+    llvm::DIType* cell_ty = dbuilder->createBasicType("unsigned char", 8, llvm::dwarf::DW_ATE_unsigned_char);
+
+    llvm::DIType* tape_ty = dbuilder->createArrayType(brain::CELL_SIZE * 8, 8, cell_ty,
+                                                      dbuilder->getOrCreateArray({dbuilder->getOrCreateSubrange(0, brain::CELL_SIZE)}));
+
+    llvm::DILocalVariable* head_var = dbuilder->createAutoVariable(sp, "head", dfile, 1, head_ty);
+    llvm::DILocalVariable* tape_var = dbuilder->createAutoVariable(sp, "tape", dfile, 1, tape_ty);
+
+    dbuilder->insertDeclare(idx, head_var, dbuilder->createExpression(), builder->getCurrentDebugLocation(), builder->GetInsertBlock());
+    dbuilder->insertDeclare(cell, tape_var, dbuilder->createExpression(), builder->getCurrentDebugLocation(), builder->GetInsertBlock());
+}
+
+
+// ------------------------------------------------------------
+//  set_location
+// 
+//  Point the builder's debug location at the given node. Lines
+//  and characters are 1-based in DWARF.
+// ------------------------------------------------------------
+void code_gen::set_location(const std::shared_ptr<ast>& t) {
+
+    if (!dbuilder || scopes.empty()) return;
+
+    builder->SetCurrentDebugLocation(llvm::DILocation::get(*ctx, t->line + 1, t->chr + 1, scopes.back()));
+}
+
+
+// ------------------------------------------------------------
+//  init_profile
+// 
+//  Create the profile counters, and a table describing each
+//  loop, then hand them to the runtime which reports at exit.
+// ------------------------------------------------------------
+void code_gen::init_profile(std::shared_ptr<ast>& t) {
+
+    if (!profile) return;
+
+    // Gather the loops in the same order visit_loop will number them.
+    std::vector<std::shared_ptr<ast> > loops, stack{t};
+
+    while (!stack.empty()) {
+        std::shared_ptr<ast> node = stack.back();
+        stack.pop_back();
+
+        if (node->token == brain::loop) loops.push_back(node);
+        stack.insert(stack.end(), node->children.rbegin(), node->children.rend());
+    }
+
+    // Describe each loop, with the cell accesses and I/O that one pass through it's body makes.
+    llvm::StructType* loop_ty = llvm::StructType::get(*ctx, {builder->getInt32Ty(), builder->getInt32Ty(), builder->getInt32Ty(), builder->getInt32Ty()});
+    std::vector<llvm::Constant*> table;
+
+    for (std::shared_ptr<ast>& l : loops) {
+        int cells = 0, io = 0;
+
+        for (std::shared_ptr<ast>& c : l->children) {
+            cells += c->token == brain::plus || c->token == brain::minus || c->token == brain::period || c->token == brain::comma;
+            io += c->token == brain::period || c->token == brain::comma;
+        }
+
+        table.push_back(llvm::ConstantStruct::get(loop_ty, {builder->getInt32(l->line + 1), builder->getInt32(l->chr + 1), builder->getInt32(cells), builder->getInt32(io)}));
+    }
+
+    llvm::ArrayType* table_ty = llvm::ArrayType::get(loop_ty, loops.size());
+    llvm::GlobalVariable* loop_table = new llvm::GlobalVariable(*mod, table_ty, true, llvm::GlobalValue::PrivateLinkage,
+                                                                llvm::ConstantArray::get(table_ty, table), "prof_loops");
+
+    // The counters themselves, all starting at zero.
+    llvm::ArrayType* counts_ty = llvm::ArrayType::get(builder->getInt64Ty(), 2 * loops.size());
+    llvm::ArrayType* hist_ty = llvm::ArrayType::get(builder->getInt64Ty(), brain::CELL_SIZE);
+
+    prof_counts = new llvm::GlobalVariable(*mod, counts_ty, false, llvm::GlobalValue::InternalLinkage, llvm::ConstantAggregateZero::get(counts_ty), "prof_counts");
+    prof_hist = new llvm::GlobalVariable(*mod, hist_ty, false, llvm::GlobalValue::InternalLinkage, llvm::ConstantAggregateZero::get(hist_ty), "prof_hist");
+
+    // Register everything with the runtime.
+    llvm::Type* i8_ptr = builder->getInt8PtrTy();
+    llvm::FunctionCallee init = mod->getOrInsertFunction("brain_rt_profile_init", builder->getVoidTy(), i8_ptr, i8_ptr, i8_ptr,
+                                                         builder->getInt64Ty(), i8_ptr, builder->getInt64Ty());
+
+    builder->CreateCall(init, {builder->CreateGlobalStringPtr(prog_name, "prog_name"),
+                               builder->CreateBitCast(loop_table, i8_ptr), builder->CreateBitCast(prof_counts, i8_ptr),
+                               builder->getInt64(loops.size()), builder->CreateBitCast(prof_hist, i8_ptr), builder->getInt64(brain::CELL_SIZE)});
+}
+
+
+// ------------------------------------------------------------
+//  profile_count
+// 
+//  Increment counter[i].
+// ------------------------------------------------------------
+void code_gen::profile_count(llvm::GlobalVariable* counter, llvm::Value* i) {
+
+    llvm::Type* counter_ty = counter->getValueType();
+    llvm::Value* gep = builder->CreateInBoundsGEP(counter_ty, counter, {builder->getInt64(0), i}, "prof_gep");
+
+    llvm::Value* cnt = builder->CreateLoad(builder->getInt64Ty(), gep, "prof_load");
+    builder->CreateStore(builder->CreateAdd(cnt, builder->getInt64(1), "prof_incr"), gep);
+}
+
+
+// ------------------------------------------------------------
+//  init_shared
+// 
+//  A loop is shared when there are at least two cold copies of
+//  it with SHARE_MIN_SIZE ops or more. Without a profile, the
+//  copies outside of any other loop are cold. With one, it's
+//  the copies that weren't entered often enough to be hot.
+//  The hot copies stay inline. Functions can't reach the I/O
+//  of bf_<abi_name>, and profiling numbers every loop, so
+//  neither shares anything.
+// ------------------------------------------------------------
+void code_gen::init_shared(const std::shared_ptr<ast>& t) {
+
+    if (!dedup || profile || !abi_name.empty()) return;
+
+    // Gather the cold copies of each shape, walking the tree with how many loops each node is inside.
+    std::map<size_t, std::vector<const ast*> > copies;
+    std::map<size_t, size_t> sizes;
+    std::vector<std::pair<std::shared_ptr<ast>, size_t> > stack{{t, 0}};
+
+    while (!stack.empty()) {
+        auto [node, depth] = stack.back();
+        stack.pop_back();
+
+        if ((node->token == brain::loop || node->token == brain::branch) && node->shape) {
+            auto it = prof_use.find({node->line + 1, node->chr + 1});
+            bool cold = prof_use.empty() ? depth == 0 : it == prof_use.end() || it->second.entries < prof_hot;
+
+            if (cold) {
+                copies[node->shape].push_back(node.get());
+                if (!sizes.count(node->shape)) sizes[node->shape] = brain::count_nodes(node) + 1;
+            }
+        }
+
+        for (const std::shared_ptr<ast>& c : node->children) stack.push_back({c, depth + (node->token == brain::loop)});
+    }
+
+    for (auto& [shape, nodes] : copies) {
+        if (nodes.size() < 2 || sizes[shape] < brain::SHARE_MIN_SIZE) continue;
+
+        shared.insert(nodes.begin(), nodes.end());
+        shared_loops += nodes.size();
+    }
+}
+
+
+// ------------------------------------------------------------
+//  init_steps
+//
+//  The steps left live in a global shared by main and the
+//  outlined functions, or on the stack of bf_<abi_name>, so
+//  each call gets it's own. main and bf_<abi_name> just return
+//  when they run out, which also flushes main's output. The
+//  outlined functions have to exit, which does the same.
+// ------------------------------------------------------------
+void code_gen::init_steps(llvm::Function* fn, bool top) {
+
+    if (!step_budget) return;
+
+    if (top && !abi_name.empty()) {
+        llvm::IRBuilder<> entry(&fn->getEntryBlock(), fn->getEntryBlock().begin());
+        steps = entry.CreateAlloca(builder->getInt64Ty(), 0, "steps");
+        entry.CreateStore(builder->getInt64(step_budget), steps);
+    } else if (top) {
+        steps = new llvm::GlobalVariable(*mod, builder->getInt64Ty(), false, llvm::GlobalValue::InternalLinkage, builder->getInt64(step_budget), "steps");
+    }
+
+    llvm::IRBuilderBase::InsertPoint ip = builder->saveIP();
+    out_of_steps = llvm::BasicBlock::Create(*ctx, "out_of_steps", fn);
+    builder->SetInsertPoint(out_of_steps);
+
+    if (top) {
+        builder->CreateRet(builder->getInt32(brain::STEP_EXIT));
+    } else {
+        llvm::FunctionCallee exit = mod->getOrInsertFunction("exit", builder->getVoidTy(), builder->getInt32Ty());
+        builder->CreateCall(exit, {builder->getInt32(brain::STEP_EXIT)});
+        builder->CreateUnreachable();
+    }
+
+    builder->restoreIP(ip);
+}
+
+
+// ------------------------------------------------------------
+//  charge_steps
+//
+//  Take n steps off the budget, and end the program if that
+//  was the last of them. Running out is marked as unlikely,
+//  so the check stays off the loop's hot path.
+// ------------------------------------------------------------
+void code_gen::charge_steps(uint64_t n) {
+
+    if (!steps) return;
+
+    llvm::BasicBlock* next = llvm::BasicBlock::Create(*ctx, "steps_left", builder->GetInsertBlock()->getParent());
+
+    llvm::Value* left = builder->CreateSub(builder->CreateLoad(builder->getInt64Ty(), steps, "steps"), builder->getInt64(n), "left");
+    builder->CreateStore(left, steps);
+
+    llvm::MDBuilder md(*ctx);
+    builder->CreateCondBr(builder->CreateICmpSLT(left, builder->getInt64(0), "spent"), out_of_steps, next, md.createBranchWeights(1, 1 << 20));
+
+    builder->SetInsertPoint(next);
+}
+
+
+// ------------------------------------------------------------
+//  init_profile_use
+// 
+//  Give the module a profile summary built from the recorded
+//  counts, and main an entry count. Together these let the
+//  optimizer treat the branch weights as real counts.
+// ------------------------------------------------------------
+void code_gen::init_profile_use(llvm::Function* main) {
+
+    if (prof_use.empty()) return;
+
+    // Every loop contributes the counts of it's cond/join blocks and body.
+    std::vector<uint64_t> counts{1};
+
+    for (auto& p : prof_use) counts.insert(counts.end(), {p.second.entries, p.second.iterations});
+    std::sort(counts.rbegin(), counts.rend());
+
+    uint64_t total = std::accumulate(counts.begin(), counts.end(), (uint64_t) 0);
+    prof_hot = std::max<uint64_t>(counts.front() / 100, 1);
+
+    // For each cutoff, find the smallest count among the hottest counts that make up that share of the total.
+    llvm::SummaryEntryVector detailed;
+    uint64_t seen = 0;
+    size_t n = 0;
+
+    for (uint32_t cutoff : llvm::ProfileSummaryBuilder::DefaultCutoffs) {
+        while (n < counts.size() && seen < total * (cutoff / 1000000.0)) seen += counts[n++];
+        detailed.emplace_back(cutoff, counts[n ? n - 1 : 0], n);
+    }
+
+    llvm::ProfileSummary summary(llvm::ProfileSummary::PSK_Instr, detailed, total, counts.front(), counts.front(), 1, counts.size(), 1);
+
+    mod->setProfileSummary(summary.getMD(*ctx), llvm::ProfileSummary::PSK_Instr);
+    main->setEntryCount(llvm::Function::ProfileCount(1, llvm::Function::PCT_Real));
+}
+
+
+// ------------------------------------------------------------
+//  annotate_loop
+// 
+//  Attach the recorded counts to a loop's condition branch as
+//  branch weights, and unrolling hints to it's latch.
+// ------------------------------------------------------------
+void code_gen::annotate_loop(const std::shared_ptr<ast>& t, llvm::BranchInst* cond_br, llvm::BranchInst* latch) {
+
+    // Loops are matched up by their position, loops that didn't run at all might not be recorded.
+    auto it = prof_use.find({t->line + 1, t->chr + 1});
+    if (it == prof_use.end() || it->second.entries == 0) return;
+
+    uint64_t iters = it->second.iterations, exits = it->second.entries;
+
+    // Branch weights are 32 bit, so scale down big counts keeping the ratio.
+    uint64_t scale = std::max(iters, exits) / UINT32_MAX + 1;
+
+    llvm::MDBuilder md(*ctx);
+    cond_br->setMetadata(llvm::LLVMContext::MD_prof, md.createBranchWeights(iters / scale, exits / scale));
+
+    // Unroll hot loops with long trips, and keep the ones that never iterate small.
+    llvm::Metadata* hint;
+
+    if (iters >= prof_hot && iters >= 8 * exits) {
+        hint = llvm::MDNode::get(*ctx, {llvm::MDString::get(*ctx, "llvm.loop.unroll.count"), llvm::ConstantAsMetadata::get(builder->getInt32(4))});
+    } else if (iters == 0) {
+        hint = llvm::MDNode::get(*ctx, {llvm::MDString::get(*ctx, "llvm.loop.unroll.disable")});
+    } else {
+        return;
+    }
+
+    // Loop IDs refer back to themselves.
+    llvm::MDNode* loop_id = llvm::MDNode::getDistinct(*ctx, {nullptr, hint});
+    loop_id->replaceOperandWith(0, loop_id);
+
+    latch->setMetadata(llvm::LLVMContext::MD_loop, loop_id);
 }
\ No newline at end of file
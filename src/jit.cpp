@@ -0,0 +1,250 @@
+// ------------------------------------------------------------
+//  jit.cpp
+//
+//  Programs are compiled like a single --incremental region,
+//  into a function taking the tape and head, and loaded into
+//  one process wide LLJIT. The generated code calls putchar
+//  and getchar as usual, but here those resolve to functions
+//  that go through the jit_io of the run on the same thread,
+//  so many runs can share the code at once.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <map>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <system_error>
+
+#include "llvm/ExecutionEngine/Orc/LLJIT.h"
+#include "llvm/ExecutionEngine/Orc/ExecutionUtils.h"
+#include "llvm/ExecutionEngine/Orc/ThreadSafeModule.h"
+#include "llvm/Support/Error.h"
+
+#include "brainc.h"
+#include "ast_builder.h"
+#include "bf_optimizer.h"
+#include "code_gen.h"
+#include "lowering.h"
+#include "batch.h"
+
+
+// The I/O of the run on this thread, if there is one.
+static thread_local const brain::jit_io* current_io = nullptr;
+
+// The JIT everything is loaded into, and the programs already compiled, keyed by their options and source.
+static std::mutex jit_lock;
+static std::unique_ptr<llvm::orc::LLJIT> jit;
+static std::map<std::string, std::shared_ptr<const brain::jit_program> > programs;
+
+
+// ------------------------------------------------------------
+//  jit_putchar / jit_getchar
+//
+//  Stand ins for putchar and getchar in the compiled code.
+// ------------------------------------------------------------
+static int jit_putchar(int c) {
+
+    if (current_io && current_io->write) current_io->write(current_io->user, c);
+    return c;
+}
+
+static int jit_getchar() {
+
+    if (current_io && current_io->read) return current_io->read(current_io->user);
+    return EOF;
+}
+
+
+// ------------------------------------------------------------
+//  init_jit
+//
+//  Create the JIT, with the compiled code's I/O going through
+//  the functions above, and anything else it needs, like
+//  memset, coming from the process. Called with the lock held.
+// ------------------------------------------------------------
+static bool init_jit() {
+
+    if (jit) return true;
+
+    llvm::Expected<std::unique_ptr<llvm::orc::LLJIT> > created = llvm::orc::LLJITBuilder().create();
+
+    if (!created) {
+        llvm::consumeError(created.takeError());
+        return false;
+    }
+
+    llvm::orc::JITDylib& dylib = (*created)->getMainJITDylib();
+    llvm::orc::SymbolMap io;
+
+    io[(*created)->mangleAndIntern("putchar")] = llvm::JITEvaluatedSymbol(llvm::pointerToJITTargetAddress(&jit_putchar), llvm::JITSymbolFlags::Exported);
+    io[(*created)->mangleAndIntern("getchar")] = llvm::JITEvaluatedSymbol(llvm::pointerToJITTargetAddress(&jit_getchar), llvm::JITSymbolFlags::Exported);
+
+    if (llvm::Error err = dylib.define(llvm::orc::absoluteSymbols(io))) {
+        llvm::consumeError(std::move(err));
+        return false;
+    }
+
+    llvm::Expected<std::unique_ptr<llvm::orc::DynamicLibrarySearchGenerator> > process =
+        llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess((*created)->getDataLayout().getGlobalPrefix());
+
+    if (!process) {
+        llvm::consumeError(process.takeError());
+        return false;
+    }
+
+    dylib.addGenerator(std::move(*process));
+    jit = std::move(*created);
+
+    return true;
+}
+
+
+// ------------------------------------------------------------
+//  run
+//
+//  Swap in the run's I/O for as long as it takes, which also
+//  handles a callback running another program.
+// ------------------------------------------------------------
+uint16_t brain::jit_program::run(uint8_t* tape, const jit_io& io, uint16_t head) const {
+
+    const jit_io* outer = current_io;
+    current_io = &io;
+
+    head = fn(tape, head);
+
+    current_io = outer;
+    return head;
+}
+
+
+// ------------------------------------------------------------
+//  run
+//
+//  Read from and write to strings.
+// ------------------------------------------------------------
+std::string brain::jit_program::run(const std::string& input) const {
+
+    struct buffers {
+        const std::string& in;
+        size_t pos;
+        std::string out;
+    } bufs{input, 0, ""};
+
+    jit_io io;
+    io.user = &bufs;
+    io.read = [](void* user) { buffers* b = (buffers*) user; return b->pos < b->in.size() ? (int) (uint8_t) b->in[b->pos++] : -1; };
+    io.write = [](void* user, uint8_t c) { ((buffers*) user)->out += (char) c; };
+
+    std::vector<uint8_t> tape(brain::CELL_SIZE, 0);
+    run(tape.data(), io);
+
+    return bufs.out;
+}
+
+
+// ------------------------------------------------------------
+//  build
+//
+//  Compile a program that isn't in the JIT yet, and load it
+//  in under key.
+// ------------------------------------------------------------
+static std::shared_ptr<const brain::jit_program> build(const std::string& source, const brain::jit_options& options, const std::string& key,
+                                                       std::error_code& ec) {
+
+    // Build the AST, and fold it at the bf level first when optimizing.
+    ast_builder ast_pass(source);
+    std::shared_ptr<ast> tree = std::make_shared<ast>(brain::root);
+    ast_pass.visit(tree);
+
+    if (ast_pass.ec != brain_errc::no_err) {
+        ec = ast_pass.ec;
+        return nullptr;
+    }
+
+    if (options.opt_level > 0) {
+        bf_optimizer opt_pass;
+        opt_pass.visit(tree);
+    }
+
+    // Every program gets a name of it's own in the shared JIT.
+    static size_t next_id = 0;
+    std::string name;
+
+    {
+        std::lock_guard<std::mutex> guard(jit_lock);
+        name = "brain_jit_" + std::to_string(next_id++);
+    }
+
+    code_gen gen_pass(name);
+
+    if (!gen_pass.initialize_module()) {
+        ec = gen_pass.ec;
+        return nullptr;
+    }
+
+    gen_pass.visit_region(tree->children, name);
+
+    if (gen_pass.ec != brain_errc::no_err) {
+        ec = gen_pass.ec;
+        return nullptr;
+    }
+
+    lowering lower_pass(std::move(gen_pass.mod), std::move(gen_pass.machine));
+    lower_pass.optimize(options.opt_level);
+
+    // Hand the module to the JIT, which compiles it on lookup.
+    std::lock_guard<std::mutex> guard(jit_lock);
+
+    if (!init_jit()) {
+        ec = brain_errc::jit_bad_init;
+        return nullptr;
+    }
+
+    llvm::Error add_err = jit->addIRModule(llvm::orc::ThreadSafeModule(std::move(lower_pass.mod), std::move(gen_pass.ctx)));
+    llvm::Expected<llvm::JITEvaluatedSymbol> sym = add_err ? llvm::Expected<llvm::JITEvaluatedSymbol>(std::move(add_err)) : jit->lookup(name);
+
+    if (!sym) {
+        llvm::consumeError(sym.takeError());
+        ec = brain_errc::jit_bad_load;
+        return nullptr;
+    }
+
+    auto fn = (uint16_t (*)(uint8_t*, uint16_t)) sym->getAddress();
+    auto inserted = programs.insert({key, std::make_shared<const brain::jit_program>(fn)});
+
+    return inserted.first->second;
+}
+
+
+// ------------------------------------------------------------
+//  compile
+//
+//  The lock is only held to look up and add to the JIT, so
+//  compiles on different threads mostly run in parallel. If
+//  two threads compile the same program at once, both are
+//  loaded and whichever finishes first is kept.
+// ------------------------------------------------------------
+std::shared_ptr<const brain::jit_program> brain::compile(const std::string& source, const jit_options& options, std::error_code& ec) {
+
+    std::string key = std::to_string(options.opt_level) + ":" + source;
+
+    {
+        std::lock_guard<std::mutex> guard(jit_lock);
+
+        auto it = programs.find(key);
+        if (it != programs.end()) return it->second;
+    }
+
+    // The passes recurse through the loops, so deeply nested programs are built on a thread with a stack to match.
+    size_t stack_bytes = brain::stack_for_depth(brain::nesting_depth(source));
+    if (!stack_bytes) return build(source, options, key, ec);
+
+    std::shared_ptr<const jit_program> program;
+    brain::run_with_stack(stack_bytes, [&] { program = build(source, options, key, ec); });
+
+    return program;
+}
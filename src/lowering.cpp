@@ -10,21 +10,78 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <map>
+#include <algorithm>
+#include <mutex>
 #include <system_error>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#if BRAINC_LLD
+#include <link.h>
+#include "lld/Common/Driver.h"
+#endif
 
 #include "llvm/Pass.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/PassManager.h"
 #include "llvm/IR/LegacyPassManager.h"
+#include "llvm/IR/PassTimingInfo.h"
+#include "llvm/IR/DiagnosticHandler.h"
+#include "llvm/IR/DiagnosticInfo.h"
 #include "llvm/Passes/PassBuilder.h"
 #include "llvm/Passes/PassPlugin.h"
+#include "llvm/Transforms/Scalar/LoopUnrollPass.h"
+#include "llvm/Transforms/IPO/HotColdSplitting.h"
+#include "llvm/Transforms/Utils/Mem2Reg.h"
+#include "llvm/Transforms/Scalar/EarlyCSE.h"
+#include "llvm/Transforms/Scalar/SimplifyCFG.h"
+#include "llvm/Transforms/InstCombine/InstCombine.h"
 #include "llvm/Target/TargetMachine.h"
+#include "llvm/Support/TargetRegistry.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/Program.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/Timer.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Bitcode/BitcodeReader.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/Transforms/Utils/Cloning.h"
 
 #include "lowering.h"
 #include "bf_error.h"
 #include "util.h"
+#include "batch.h"
+
+
+// Diagnostic handler that counts every optimization remark, instead of printing them.
+struct remark_counter : public llvm::DiagnosticHandler {
+
+    std::map<std::tuple<std::string, std::string, std::string>, lowering::remark_summary>& remarks;
+
+    remark_counter(std::map<std::tuple<std::string, std::string, std::string>, lowering::remark_summary>& r): remarks(r) {};
+
+    // Passes only build their remarks when asked for them.
+    bool isAnalysisRemarkEnabled(llvm::StringRef pass) const override { return true; }
+    bool isMissedOptRemarkEnabled(llvm::StringRef pass) const override { return true; }
+    bool isPassedOptRemarkEnabled(llvm::StringRef pass) const override { return true; }
+    bool isAnyRemarkEnabled() const override { return true; }
+
+    bool handleDiagnostics(const llvm::DiagnosticInfo& di) override {
+        auto* remark = llvm::dyn_cast<llvm::DiagnosticInfoOptimizationBase>(&di);
+        if (!remark) return false;
+
+        std::string kind = remark->isPassed() ? "passed" : remark->isMissed() ? "missed" : "analysis";
+        lowering::remark_summary& sum = remarks[{remark->getPassName().str(), kind, remark->getRemarkName().str()}];
+
+        if (sum.count++ == 0) sum.example = remark->getMsg();
+        return true;
+    }
+};
 
 
 // ------------------------------------------------------------
@@ -34,6 +91,43 @@
 // ------------------------------------------------------------
 void lowering::optimize(size_t opt_level) {
 
+    // Split the module up first if we can, then optimize the parts in parallel.
+    std::vector<llvm::SmallVector<char, 0> > bitcode;
+    if (threads > 1 && !time_passes && !collect_remarks) bitcode = split();
+
+    if (!bitcode.empty()) {
+        parts.resize(bitcode.size());
+
+        brain::run_pool(bitcode.size(), threads, [&](size_t i) {
+            parts[i] = std::make_unique<lowering>();
+            parts[i]->ctx = std::make_unique<llvm::LLVMContext>();
+
+            llvm::Expected<std::unique_ptr<llvm::Module> > part_mod = llvm::parseBitcodeFile(
+                llvm::MemoryBufferRef(llvm::StringRef(bitcode[i].data(), bitcode[i].size()), mod->getName()), *parts[i]->ctx);
+
+            if (!part_mod) {
+                llvm::consumeError(part_mod.takeError());
+                parts[i]->ec = brain_errc::lower_object;
+                return;
+            }
+
+            // Target machines aren't safe to share between threads, so each part gets it's own.
+            parts[i]->mod = std::move(*part_mod);
+            parts[i]->machine.reset(machine->getTarget().createTargetMachine(machine->getTargetTriple().str(), machine->getTargetCPU(),
+                                                                             machine->getTargetFeatureString(), machine->Options,
+                                                                             machine->getRelocationModel(), machine->getCodeModel(),
+                                                                             machine->getOptLevel()));
+            parts[i]->light = light;
+            parts[i]->optimize(opt_level);
+        });
+
+        for (std::unique_ptr<lowering>& part : parts) {
+            if (part->ec != brain_errc::no_err) ec = part->ec;
+        }
+
+        return;
+    }
+
     // Initialize the pass managers.
     llvm::LoopAnalysisManager lam;
     llvm::FunctionAnalysisManager fam;
@@ -42,6 +136,17 @@ void lowering::optimize(size_t opt_level) {
 
     llvm::PassBuilder pb;
 
+    // Timing goes through the pass instrumentation, which has to be registered before the defaults are.
+    if (time_passes) {
+        timers = std::make_unique<llvm::TimePassesHandler>(true);
+        timers->registerCallbacks(pic);
+
+        mam.registerPass([this] { return llvm::PassInstrumentationAnalysis(&pic); });
+        cgam.registerPass([this] { return llvm::PassInstrumentationAnalysis(&pic); });
+        fam.registerPass([this] { return llvm::PassInstrumentationAnalysis(&pic); });
+        lam.registerPass([this] { return llvm::PassInstrumentationAnalysis(&pic); });
+    }
+
     // Register all the basic analyses with the managers.
     pb.registerModuleAnalyses(mam);
     pb.registerCGSCCAnalyses(cgam);
@@ -60,29 +165,68 @@ void lowering::optimize(size_t opt_level) {
         default: opt = llvm::PassBuilder::OptimizationLevel::O2;
     }
 
-    // Optimize the IR.
-    llvm::FunctionPassManager fpm = pb.buildFunctionSimplificationPipeline(opt, llvm::PassBuilder::ThinLTOPhase::None);
+    // Swap in the remark counter for the length of the optimization.
+    if (collect_remarks) mod->getContext().setDiagnosticHandler(std::make_unique<remark_counter>(remarks));
+
+    // Optimize the IR. The light pipeline gets the index out of memory and tidies up, which is most of what
+    // codegen needs to be quick, without any of the loop passes.
+    llvm::FunctionPassManager fpm;
+
+    if (light) {
+        fpm.addPass(llvm::PromotePass());
+        fpm.addPass(llvm::EarlyCSEPass());
+        fpm.addPass(llvm::InstCombinePass());
+        fpm.addPass(llvm::SimplifyCFGPass());
+    } else {
+        fpm = pb.buildFunctionSimplificationPipeline(opt, llvm::PassBuilder::ThinLTOPhase::None);
+    }
+
+    for (llvm::Function& fn : *mod) {
+        if (!fn.isDeclaration()) fpm.run(fn, fam);
+    }
+
+    // With a recorded profile, also unroll the loops it marked as hot and split the cold code out of main.
+    if (opt_level > 0 && mod->getProfileSummary(false)) {
+        llvm::FunctionPassManager unroll_fpm;
+        unroll_fpm.addPass(llvm::LoopUnrollPass(llvm::LoopUnrollOptions(opt_level)));
+
+        for (llvm::Function& fn : *mod) {
+            if (!fn.isDeclaration()) unroll_fpm.run(fn, fam);
+        }
+
+        llvm::ModulePassManager mpm;
+        mpm.addPass(llvm::HotColdSplittingPass());
+        mpm.run(*mod, mam);
+    }
 
-    fpm.run(*mod->getFunction("main"), fam);
+    // Then go back to the default, which doesn't ask for any remarks.
+    if (collect_remarks) mod->getContext().setDiagnosticHandler(std::make_unique<llvm::DiagnosticHandler>());
 }
 
 
 // ------------------------------------------------------------
 //  compile
 // 
-//  Compile the LLVM IR down to either asm or obj file.
+//  Compile the LLVM IR down to either asm or an object file,
+//  kept in memory.
 // ------------------------------------------------------------
-void lowering::compile(std::string output_file, bool target_asm) {
+void lowering::compile(bool target_asm) {
 
-    // Initialize the output stream.
-    std::error_code llvm_ec;
-    llvm::raw_fd_ostream dest(output_file, llvm_ec, llvm::sys::fs::OF_None);
+    // Each part compiles to it's own object.
+    if (!parts.empty()) {
+        brain::run_pool(parts.size(), threads, [&](size_t i) { parts[i]->compile(target_asm); });
+
+        for (std::unique_ptr<lowering>& part : parts) {
+            if (part->ec != brain_errc::no_err) ec = part->ec;
+        }
 
-    if (llvm_ec) {
-        ec = brain_errc::lower_output;
         return;
     }
 
+    // Initialize the output stream.
+    obj.clear();
+    llvm::raw_svector_ostream dest(obj);
+
     // Run the LLVM legacy pass manager to lower the IR.
     llvm::legacy::PassManager pass;
     llvm::CodeGenFileType file_type = target_asm ? llvm::CGFT_AssemblyFile : llvm::CGFT_ObjectFile;
@@ -92,17 +236,225 @@ void lowering::compile(std::string output_file, bool target_asm) {
         return;
     }
 
+    // The legacy pass manager has its own switch for timing. It's global, so leave it alone unless timing.
+    if (time_passes) llvm::TimePassesIsEnabled = true;
+
     pass.run(*mod);
-    dest.flush();
+}
+
+
+// ------------------------------------------------------------
+//  split
+// 
+//  Hand the functions out biggest first, each to the part with
+//  the fewest instructions so far. Everything else is defined
+//  in the first part. Each part is a copy of the module with
+//  only it's own definitions, written to bitcode so it can be
+//  read back into a context of it's own.
+// ------------------------------------------------------------
+std::vector<llvm::SmallVector<char, 0> > lowering::split() {
+
+    std::vector<llvm::Function*> fns;
+
+    for (llvm::Function& fn : *mod) {
+        if (!fn.isDeclaration()) fns.push_back(&fn);
+    }
+
+    if (fns.size() < 2) return {};
+
+    std::sort(fns.begin(), fns.end(), [](llvm::Function* a, llvm::Function* b) { return a->getInstructionCount() > b->getInstructionCount(); });
+
+    std::vector<size_t> sizes(std::min(threads, fns.size()), 0);
+    std::map<const llvm::GlobalValue*, size_t> owner;
+
+    for (llvm::Function* fn : fns) {
+        size_t p = std::min_element(sizes.begin(), sizes.end()) - sizes.begin();
+        owner[fn] = p, sizes[p] += fn->getInstructionCount();
+    }
+
+    // The parts refer to each other's symbols, so nothing can stay local. Hidden keeps them out of the executable's exports.
+    for (llvm::GlobalValue& gv : mod->global_values()) {
+        if (!gv.hasLocalLinkage()) continue;
+
+        if (!gv.hasName()) gv.setName("brain.local");
+        gv.setLinkage(llvm::GlobalValue::ExternalLinkage);
+        gv.setVisibility(llvm::GlobalValue::HiddenVisibility);
+    }
+
+    std::vector<llvm::SmallVector<char, 0> > bitcode(sizes.size());
+
+    for (size_t p = 0; p < sizes.size(); p++) {
+        llvm::ValueToValueMapTy vmap;
+        std::unique_ptr<llvm::Module> part = llvm::CloneModule(*mod, vmap, [&](const llvm::GlobalValue* gv) {
+            auto it = owner.find(gv);
+            return it == owner.end() ? p == 0 : it->second == p;
+        });
+
+        llvm::raw_svector_ostream os(bitcode[p]);
+        llvm::WriteBitcodeToFile(*part, os);
+    }
+
+    return bitcode;
+}
+
+
+// ------------------------------------------------------------
+//  object_size
+// ------------------------------------------------------------
+size_t lowering::object_size() const {
+
+    size_t size = obj.size();
+    for (const std::unique_ptr<lowering>& part : parts) size += part->obj.size();
+
+    return size;
+}
+
+
+// ------------------------------------------------------------
+//  write
+// 
+//  Write the compiled asm or object file out.
+// ------------------------------------------------------------
+void lowering::write(const std::string& output_file) {
+
+    std::error_code llvm_ec;
+    llvm::raw_fd_ostream dest(output_file, llvm_ec, llvm::sys::fs::OF_None);
+
+    if (llvm_ec) {
+        ec = brain_errc::lower_output;
+        return;
+    }
+
+    dest.write(obj.data(), obj.size());
 }
 
 
 // ------------------------------------------------------------
 //  link
 // 
-//  Link the object file and produce the final executable.
+//  Link the object file and produce the final executable. The
+//  linker reads the object from an anonymous in-memory file.
+// ------------------------------------------------------------
+void lowering::link(std::string exe_file, size_t lto_level, const std::vector<std::string>& libs) {
+
+    for (const std::string& lib : libs) {
+        if (!llvm::sys::fs::exists(lib)) {
+            ec = brain_errc::lower_runtime;
+            return;
+        }
+    }
+
+    // The object, if it was compiled, along with each part's object when the module was split or built in regions.
+    std::vector<const llvm::SmallVector<char, 0>*> objs;
+
+    if (!obj.empty()) objs.push_back(&obj);
+    for (std::unique_ptr<lowering>& part : parts) objs.push_back(&part->obj);
+
+    // On Linux the objects never touch the disk. Elsewhere they go to uniquely named temp files, never the working directory.
+    std::vector<std::string> obj_files;
+    std::vector<int> fds;
+
+    for (const llvm::SmallVector<char, 0>* o : objs) {
+        std::string obj_file;
+        int fd = -1;
+
+#if defined(__linux__)
+        fd = memfd_create("brainc-obj", 0);
+        obj_file = "/proc/self/fd/" + std::to_string(fd);
+#else
+        llvm::SmallString<128> tmp;
+        if (!llvm::sys::fs::createTemporaryFile("brainc", "o", fd, tmp)) obj_file = std::string(tmp);
+#endif
+
+        if (fd >= 0) fds.push_back(fd), obj_files.push_back(obj_file);
+
+        if (fd < 0 || ::write(fd, o->data(), o->size()) != (ssize_t) o->size()) {
+            ec = brain_errc::lower_output;
+            break;
+        }
+
+        if (brain::DEBUG) std::cerr << "object file: " << obj_file << ", executible: " << exe_file << std::endl;
+    }
+
+#if BRAINC_LLD
+    if (ec == brain_errc::no_err) link_lld(obj_files, exe_file, lto_level, libs);
+#else
+    if (ec == brain_errc::no_err) link_clang(obj_files, exe_file, lto_level, libs);
+#endif
+
+    for (size_t i = 0; i < fds.size(); i++) {
+        ::close(fds[i]);
+
+#if !defined(__linux__)
+        llvm::sys::fs::remove(obj_files[i]);
+#endif
+    }
+}
+
+
+#if BRAINC_LLD
+// ------------------------------------------------------------
+//  find_interp
+// 
+//  dl_iterate_phdr callback, finding the dynamic linker that
+//  brainc itself was loaded by. The main program comes first.
+// ------------------------------------------------------------
+static int find_interp(struct dl_phdr_info* info, size_t size, void* data) {
+
+    for (size_t i = 0; i < info->dlpi_phnum; i++) {
+        if (info->dlpi_phdr[i].p_type == PT_INTERP) {
+            *static_cast<std::string*>(data) = reinterpret_cast<const char*>(info->dlpi_addr + info->dlpi_phdr[i].p_vaddr);
+        }
+    }
+
+    return 1;
+}
+
+
+// ------------------------------------------------------------
+//  link_lld
+// 
+//  Link in-process with lld, against the same C library and
+//  startup files brainc was built with.
 // ------------------------------------------------------------
-void lowering::link(std::string obj_file, std::string exe_file, size_t lto_level) {
+void lowering::link_lld(const std::vector<std::string>& obj_files, const std::string& exe_file, size_t lto_level, const std::vector<std::string>& libs) {
+
+    std::string interp;
+    dl_iterate_phdr(find_interp, &interp);
+
+    // A statically linked brainc has no dynamic linker to borrow.
+    if (interp.empty()) {
+        ec = brain_errc::lower_interp;
+        return;
+    }
+
+    // The level goes to any LTO the same as clang's -O<n> would, and to lld's own section merging.
+    std::string level = std::to_string(std::min<size_t>(lto_level, 3));
+
+    std::string crt = BRAINC_CRT_DIR, gcc = BRAINC_CRTBEGIN_DIR;
+    std::vector<std::string> args = {"ld.lld", "-pie", "--eh-frame-hdr", "-dynamic-linker", interp, "-o", exe_file, "--lto-O" + level, "-O" + level,
+                                     crt + "/Scrt1.o", crt + "/crti.o", gcc + "/crtbeginS.o", "-L" + crt, "-L" + gcc};
+
+    args.insert(args.end(), obj_files.begin(), obj_files.end());
+    args.insert(args.end(), libs.begin(), libs.end());
+    args.insert(args.end(), {"-lc", gcc + "/crtendS.o", crt + "/crtn.o"});
+
+    std::vector<const char*> argv;
+    for (const std::string& a : args) argv.push_back(a.c_str());
+
+    // lld keeps global state between links, so only one can run at a time.
+    static std::mutex lld_lock;
+    std::lock_guard<std::mutex> guard(lld_lock);
+
+    if (!lld::elf::link(argv, false, llvm::outs(), llvm::errs())) ec = brain_errc::lower_lld;
+}
+#else
+// ------------------------------------------------------------
+//  link_clang
+// 
+//  Link by running clang, for builds without lld.
+// ------------------------------------------------------------
+void lowering::link_clang(const std::vector<std::string>& obj_files, const std::string& exe_file, size_t lto_level, const std::vector<std::string>& libs) {
 
     // Find clang to link the program.
     auto clang = llvm::sys::findProgramByName("clang");
@@ -112,8 +464,6 @@ void lowering::link(std::string obj_file, std::string exe_file, size_t lto_level
         return;
     }
 
-    if (brain::DEBUG) std::cerr << "object file: " << obj_file << ", executible: " << exe_file << std::endl;
-
     // Get the optimization level.
     std::string opt;
     
@@ -125,15 +475,114 @@ void lowering::link(std::string obj_file, std::string exe_file, size_t lto_level
         default: opt = "-O2"; break;
     }
 
-    // Set the list of arguments to pass to clang.
-    std::vector<llvm::StringRef> clang_args = {clang.get(), opt, obj_file, "-o", exe_file};
+    // Set the list of arguments to pass to clang. The objects' paths have no extension, so clang passes them straight to the linker.
+    std::vector<llvm::StringRef> clang_args = {clang.get(), opt};
+
+    for (const std::string& obj_file : obj_files) clang_args.push_back(obj_file);
+
+    for (const std::string& lib : libs) clang_args.push_back(lib);
+
+    clang_args.insert(clang_args.end(), {"-o", exe_file});
     
-    // Run and wait on the results of clang.
+    // Run and wait on the results of clang, however long big programs take.
     std::string clang_err;
-    auto result = llvm::sys::ExecuteAndWait(clang.get(), llvm::makeArrayRef(clang_args), llvm::NoneType::None, {}, 10, 0, &clang_err);
+    auto result = llvm::sys::ExecuteAndWait(clang.get(), llvm::makeArrayRef(clang_args), llvm::NoneType::None, {}, 0, 0, &clang_err);
 
-    if (-1 == result) {
+    if (result != 0) {
         ec = brain_errc::lower_linking;
         return;
     }
+}
+#endif
+
+
+// ------------------------------------------------------------
+//  links_in_process
+// 
+//  Whether link uses lld rather than a clang child process.
+// ------------------------------------------------------------
+bool lowering::links_in_process() {
+
+#if BRAINC_LLD
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+// ------------------------------------------------------------
+//  runtime_lib
+// 
+//  Find the runtime library relative to the running brainc.
+// ------------------------------------------------------------
+std::string lowering::runtime_lib() {
+
+    // Any address in this binary will do for finding it.
+    llvm::SmallString<256> path(llvm::sys::fs::getMainExecutable(nullptr, (void*) &lowering::runtime_lib));
+
+    llvm::sys::path::remove_filename(path);
+    llvm::sys::path::append(path, "..", "lib", "libbrainrt.a");
+
+    return std::string(path);
+}
+
+
+// ------------------------------------------------------------
+//  report_timings
+// 
+//  Print the optimization and codegen pass timings, in LLVM's
+//  usual format.
+// ------------------------------------------------------------
+void lowering::report_timings() {
+
+    // The handler prints its report as it's destroyed.
+    timers.reset();
+    llvm::reportAndResetTimings();
+}
+
+
+// ------------------------------------------------------------
+//  clear_timings
+// 
+//  Throw the pass timings away without printing them.
+// ------------------------------------------------------------
+void lowering::clear_timings() {
+
+    // Timers that never triggered aren't printed, so clearing them first leaves the handler nothing to report.
+    llvm::TimerGroup::clearAll();
+    timers.reset();
+}
+
+
+// ------------------------------------------------------------
+//  timings_json
+// 
+//  Get every LLVM timer as "time.<group>.<pass>.<kind>" fields.
+// ------------------------------------------------------------
+std::string lowering::timings_json() {
+
+    std::string json;
+    llvm::raw_string_ostream os(json);
+
+    llvm::TimerGroup::printAllJSONValues(os, "\n");
+    return os.str();
+}
+
+
+// ------------------------------------------------------------
+//  print_remarks
+// 
+//  Print one line for each kind of remark.
+// ------------------------------------------------------------
+void lowering::print_remarks(std::ostream& os) const {
+
+    size_t total = 0;
+
+    for (const auto& [key, sum] : remarks) {
+        os << "  " << std::get<0>(key) << " " << std::get<1>(key) << " " << std::get<2>(key) << " x" << sum.count << ": " << sum.example << "\n";
+        total += sum.count;
+    }
+
+    os << "  " << total << " remarks\n";
 }
\ No newline at end of file
@@ -9,8 +9,14 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <vector>
+#include <set>
 #include <system_error>
 #include <filesystem>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <chrono>
 
 #include "llvm/Pass.h"
 #include "llvm/IR/LLVMContext.h"
@@ -25,102 +31,1043 @@
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Support/TargetRegistry.h"
 #include "llvm/Support/Program.h"
+#include "llvm/Support/Host.h"
 #include "llvm/IRReader/IRReader.h"
 
 #include "util.h"
 #include "ast_builder.h"
+#include "bf_optimizer.h"
+#include "bytecode.h"
 #include "code_gen.h"
 #include "cmd_parser.h"
 #include "bf_error.h"
 #include "lowering.h"
+#include "profile.h"
+#include "stats.h"
+#include "cache.h"
+#include "batch.h"
+#include "server.h"
+#include "regions.h"
+#include "budget.h"
+#include "targets.h"
+#include "brainc.h"
 
 
-int main(int argc, char** argv) {
+// ------------------------------------------------------------
+//  report_stats
+//
+//  Print or write out the statistics and pass timings asked
+//  for on the command line.
+// ------------------------------------------------------------
+static void report_stats(cmd_parser& input, brain::compile_stats& stats, lowering* lower_pass) {
 
-    // Initialize the command argument parser.
-    cmd_parser input(argc, argv);
+    stats.end();
 
-    // Printing the help message takes priority over all other input arguments.
-    if (input.option_exists("-h") || input.option_exists("--help") || input.option_exists("help")) {
-        std::cout << brain::VERSION << std::endl << brain::USAGE << brain::OPTIONS << std::endl;
-        return 0;
+    if (input.option_exists("--stats")) stats.print(std::cerr);
+
+    // Cache hits never get as far as lowering, so there are no LLVM timers.
+    if (input.option_exists("--stats-json")) {
+        std::string path = input.get_option("--stats-json");
+        std::string timers = lower_pass ? lower_pass->timings_json() : "";
+
+        if (path == "-") {
+            stats.write_json(std::cout, timers);
+        } else {
+            std::ofstream ofs(path);
+            stats.write_json(ofs, timers);
+        }
     }
 
-    // Print the version and exit.
-    if (input.option_exists("-v") || input.option_exists("--version")) {
-        std::cout << brain::VERSION;
-        return 0;
+    // Printing the timers resets them, so this goes after the JSON. Without --time-passes they were only
+    // running for the JSON, so they're cleared instead, which keeps LLVM from printing them as they're destroyed.
+    if (!lower_pass) return;
+    if (input.option_exists("--time-passes")) lower_pass->report_timings();
+    else lower_pass->clear_timings();
+}
+
+
+// ------------------------------------------------------------
+//  read_file
+//
+//  Read a whole file into a string, empty if it can't be read.
+// ------------------------------------------------------------
+static std::string read_file(const std::string& path) {
+
+    std::ifstream ifs(path, std::ios::binary);
+    std::stringstream contents;
+    contents << ifs.rdbuf();
+
+    return contents.str();
+}
+
+
+// ------------------------------------------------------------
+//  abi_name
+//
+//  Name an --abi function after the input file, made into a
+//  valid C identifier.
+// ------------------------------------------------------------
+static std::string abi_name(const std::string& input_file) {
+
+    std::string name = std::filesystem::path(input_file).stem().string();
+    for (char& c : name) if (!isalnum((unsigned char) c)) c = '_';
+
+    return name;
+}
+
+
+// ------------------------------------------------------------
+//  step_budget
+//
+//  The --step-budget given, or 0 for none.
+// ------------------------------------------------------------
+static uint64_t step_budget(cmd_parser& input) {
+
+    return input.option_exists("--step-budget") ? std::stoull(input.get_option("--step-budget")) : 0;
+}
+
+
+// ------------------------------------------------------------
+//  compile_threads
+//
+//  The threads outlined functions are compiled on, --threads
+//  or one per core. An object or asm file is always a single
+//  module, so it only gets the one.
+// ------------------------------------------------------------
+static size_t compile_threads(cmd_parser& input) {
+
+    bool emit_obj = input.option_exists("-S") || input.option_exists("-c") || input.option_exists("--abi");
+    if (emit_obj) return 1;
+
+    size_t threads = input.option_exists("--threads") ? std::stoul(input.get_option("--threads")) : std::thread::hardware_concurrency();
+    return std::max<size_t>(threads, 1);
+}
+
+
+// ------------------------------------------------------------
+//  cache_key
+//
+//  Hash the source along with everything else that affects
+//  the output. The input's path only matters when it ends up
+//  embedded in the output.
+// ------------------------------------------------------------
+static std::string cache_key(cmd_parser& input, const std::string& src) {
+
+    std::vector<std::string> parts = {brain::VERSION, src, std::to_string(input.get_opt_level()), llvm::sys::getDefaultTargetTriple(),
+                                      llvm::sys::getHostCPUName().str(), std::to_string(brain::CELL_SIZE)};
+
+    for (const char* opt : {"-c", "-S", "-g", "--bytecode", "--native", "--profile", "--outline", "--incremental", "--abi", "--executor", "--no-dedup"}) parts.push_back(input.option_exists(opt) ? opt : "");
+
+    if (input.option_exists("-g") || input.option_exists("--profile") || input.option_exists("--abi") || input.option_exists("--executor")) {
+        parts.push_back(input.get_input_file());
+        parts.push_back(std::filesystem::absolute(input.get_input_file()).string());
     }
 
+    // A budget can change the level and layout, so it's part of the key too, as are the CPU levels to build for
+    // and the step budget. The plan a budget picks also depends on how many threads can share the work.
+    for (const char* opt : {"--compile-budget", "--target-cpus", "--step-budget"}) parts.push_back(input.option_exists(opt) ? input.get_option(opt) : "");
+    parts.push_back(input.option_exists("--compile-budget") ? std::to_string(compile_threads(input)) : "");
+
+    // A recorded profile and the runtime library go in by their contents.
+    parts.push_back(input.option_exists("--profile-use") ? read_file(input.get_option("--profile-use")) : "");
+    parts.push_back(input.option_exists("-c") || input.option_exists("-S") ? "" : read_file(lowering::runtime_lib()));
+
+    return brain::compile_cache::key(parts);
+}
+
+
+// ------------------------------------------------------------
+//  compile_regions
+//
+//  Build the program out of separately compiled regions. Each
+//  region's object is cached by it's code, so only the regions
+//  that changed since the last build are compiled again, and
+//  main just calls them in turn. The workers get stack_bytes
+//  of stack, for deeply nested programs.
+// ------------------------------------------------------------
+static int compile_regions(cmd_parser& input, brain::compile_cache& cache, std::shared_ptr<ast>& tree, const std::string& out_file,
+                           size_t stack_bytes, brain::compile_stats& stats, std::ostream& err) {
+
+    stats.begin("regions");
+    std::vector<brain::region> regions = brain::split_regions(tree, brain::OUTLINE_SIZE);
+
+    // Name each region's function after it's key, so identical regions share one object.
+    std::vector<std::string> names, keys;
+    std::vector<brain::region*> unique;
+    std::set<std::string> seen;
+
+    for (brain::region& r : regions) {
+        std::string key = brain::compile_cache::key({brain::VERSION, "region", r.text, std::to_string(input.get_opt_level()),
+                                                     llvm::sys::getDefaultTargetTriple(), llvm::sys::getHostCPUName().str(),
+                                                     std::to_string(brain::CELL_SIZE)});
+        std::string name = "brain_region_" + key.substr(0, 16);
+
+        if (seen.insert(name).second) keys.push_back(key), unique.push_back(&r);
+        names.push_back(name);
+    }
+
+    stats.count("regions", regions.size());
+
+    // Reuse the objects of the regions that haven't changed.
+    stats.begin("cache");
+    std::vector<std::unique_ptr<lowering> > parts;
+    std::vector<size_t> misses;
+
+    for (size_t i = 0; i < unique.size(); i++) {
+        std::string data;
+        parts.push_back(std::make_unique<lowering>());
+
+        if (cache.load(keys[i], data)) parts[i]->obj.assign(data.begin(), data.end());
+        else misses.push_back(i);
+    }
+
+    stats.count("regions_cached", unique.size() - misses.size());
+
+    // Compile the rest in parallel, each in it's own context.
+    stats.begin("compile");
+    size_t threads = input.option_exists("--threads") ? std::stoul(input.get_option("--threads")) : std::thread::hardware_concurrency();
+
+    brain::run_pool(misses.size(), std::max<size_t>(threads, 1), [&](size_t m) {
+        size_t i = misses[m];
+        lowering& part = *parts[i];
+
+        code_gen gen_pass(input.get_input_file());
+        if (!gen_pass.initialize_module()) {
+            part.ec = gen_pass.ec;
+            return;
+        }
+
+        gen_pass.visit_region(unique[i]->nodes, "brain_region_" + keys[i].substr(0, 16));
+
+        part.ctx = std::move(gen_pass.ctx);
+        part.mod = std::move(gen_pass.mod);
+        part.machine = std::move(gen_pass.machine);
+
+        part.optimize(input.get_opt_level());
+        part.compile();
+
+        if (part.ec == brain_errc::no_err) cache.store(keys[i], std::string(part.obj.begin(), part.obj.end()));
+    }, stack_bytes);
+
+    stats.count("regions_compiled", misses.size());
+
+    for (std::unique_ptr<lowering>& part : parts) {
+        if (part->ec != brain_errc::no_err) {
+            err << brain::err_msg(part->ec.message());
+            return 1;
+        }
+    }
+
+    // Then main, and link everything together.
+    code_gen gen_pass(input.get_input_file());
+
+    if (!gen_pass.initialize_module()) {
+        err << brain::err_msg(gen_pass.ec.message());
+        return 1;
+    }
+
+    gen_pass.visit_regions(names);
+
+    lowering lower_pass(std::move(gen_pass.mod), std::move(gen_pass.machine));
+    lower_pass.compile();
+    lower_pass.parts = std::move(parts);
+
+    stats.count("object_bytes", lower_pass.object_size());
+
+    stats.begin("link");
+    if (lower_pass.ec == brain_errc::no_err) lower_pass.link(out_file, input.get_opt_level());
+
+    if (lower_pass.ec != brain_errc::no_err) {
+        err << brain::err_msg(lower_pass.ec.message());
+        return 1;
+    }
+
+    return 0;
+}
+
+
+// ------------------------------------------------------------
+//  compile_variants
+//
+//  Build the program once for each CPU level, in parallel,
+//  with main renamed after the level. Then a main that picks
+//  between them at startup is linked in with them all. The
+//  workers get stack_bytes of stack, as for compile_regions.
+// ------------------------------------------------------------
+static int compile_variants(cmd_parser& input, std::shared_ptr<ast>& tree, const std::vector<brain::cpu_level>& levels,
+                            const brain::compile_plan& plan, size_t threads, const std::string& out_file, size_t stack_bytes,
+                            brain::compile_stats& stats, std::ostream& err) {
+
+    stats.begin("variants");
+    brain::profile_map prof_use;
+
+    if (input.option_exists("--profile-use") && !brain::read_profile(input.get_option("--profile-use"), prof_use)) {
+        err << brain::err_msg(make_error_code(brain_errc::gen_bad_profile).message());
+        return 1;
+    }
+
+    std::vector<std::pair<int, std::string> > variants;
+    for (const brain::cpu_level& l : levels) variants.push_back({l.level, "brain_main_v" + std::to_string(l.level)});
+
+    std::vector<std::unique_ptr<lowering> > parts(levels.size());
+
+    brain::run_pool(levels.size(), threads, [&](size_t i) {
+        parts[i] = std::make_unique<lowering>();
+        lowering& part = *parts[i];
+
+        // Every variant gets it's own code gen pass, as LLVM contexts can't be shared between threads.
+        code_gen gen_pass(input.get_input_file(), input.option_exists("-g"));
+        gen_pass.profile = input.option_exists("--profile");
+        gen_pass.outline_size = plan.outline ? brain::OUTLINE_SIZE : 0;
+        gen_pass.prof_use = prof_use;
+        gen_pass.cpu = "x86-64", gen_pass.features = levels[i].features;
+        gen_pass.step_budget = step_budget(input);
+        gen_pass.dedup = !input.option_exists("--no-dedup");
+
+        std::shared_ptr<ast> root = tree;
+
+        if (!gen_pass.initialize_module()) {
+            part.ec = gen_pass.ec;
+            return;
+        }
+
+        gen_pass.visit(root);
+
+        if (gen_pass.ec != brain_errc::no_err) {
+            part.ec = gen_pass.ec;
+            return;
+        }
+
+        // Only the dispatching main is visible outside the executable.
+        llvm::Function* main = gen_pass.mod->getFunction("main");
+        main->setName(variants[i].second);
+        main->setVisibility(llvm::GlobalValue::HiddenVisibility);
+
+        part.ctx = std::move(gen_pass.ctx);
+        part.mod = std::move(gen_pass.mod);
+        part.machine = std::move(gen_pass.machine);
+        part.light = plan.light;
+
+        part.optimize(plan.opt_level);
+        part.compile();
+    }, stack_bytes);
+
+    for (std::unique_ptr<lowering>& part : parts) {
+        if (part->ec != brain_errc::no_err) {
+            err << brain::err_msg(part->ec.message());
+            return 1;
+        }
+    }
+
+    // The dispatching main has to run anywhere, so it's built for plain x86-64.
+    code_gen gen_pass(input.get_input_file());
+    gen_pass.cpu = "x86-64";
+
+    if (!gen_pass.initialize_module()) {
+        err << brain::err_msg(gen_pass.ec.message());
+        return 1;
+    }
+
+    gen_pass.visit_dispatch(variants);
+
+    lowering lower_pass(std::move(gen_pass.mod), std::move(gen_pass.machine));
+    lower_pass.compile();
+    lower_pass.parts = std::move(parts);
+
+    stats.count("variants", levels.size());
+    stats.count("object_bytes", lower_pass.object_size());
+
+    stats.begin("link");
+    if (lower_pass.ec == brain_errc::no_err) lower_pass.link(out_file, plan.opt_level, {lowering::runtime_lib()});
+
+    if (lower_pass.ec != brain_errc::no_err) {
+        err << brain::err_msg(lower_pass.ec.message());
+        return 1;
+    }
+
+    std::error_code size_ec;
+    stats.count("exe_bytes", std::filesystem::file_size(out_file, size_ec));
+
+    return 0;
+}
+
+
+// ------------------------------------------------------------
+//  compile_file
+//
+//  Compile the input file given on the command line, with any
+//  errors going to err. Returns the exit code. deep is set
+//  once we're on a thread with a stack for the nesting.
+// ------------------------------------------------------------
+static int compile_file(cmd_parser& input, brain::compile_cache* cache, std::ostream& err, bool deep = false) {
+
     // Make sure at least the input file is given, and that it is a valid file.
     if (!input.check_input_file()) {
-        std::cerr << brain::err_msg(input.ec.message());
-        std::cerr << brain::USAGE;
+        err << brain::err_msg(input.ec.message());
+        err << brain::USAGE;
         return 2;
     }
 
+    // Time each phase when statistics are asked for, it's cheap enough to always do.
+    brain::compile_stats stats;
+
     // Read in the file.
+    stats.begin("read");
     std::ifstream ifs(input.get_input_file());
     std::stringstream bf_prog;
     bf_prog << ifs.rdbuf();
+    stats.count("source_bytes", bf_prog.str().size());
+
+    // Every pass after the AST builder recurses through the loops, so deeply nested programs start over on a
+    // thread with a stack to match.
+    size_t depth = brain::nesting_depth(bf_prog.str());
+    size_t stack_bytes = brain::stack_for_depth(depth);
+
+    if (stack_bytes && !deep) {
+        int status = 1;
+        brain::run_with_stack(stack_bytes, [&] { status = compile_file(input, cache, err, true); });
+        return status;
+    }
+
+    // Work out the output file, an object or asm file with -c or -S, otherwise an executable. --abi implies -c.
+    bool abi = input.option_exists("--abi");
+    bool emit_obj = input.option_exists("-S") || input.option_exists("-c") || abi;
+
+    // An --executor executable is built around the same reentrant function as --abi.
+    bool executor = input.option_exists("--executor") && !emit_obj;
+    bool reentrant = abi || executor;
+    std::filesystem::path out_file;
+
+    // The reentrant function is always plain native code in one piece, so options that would instrument, plan or
+    // split it up are refused rather than silently dropped, the same as for --bundle.
+    for (const char* opt : {"--profile", "--compile-budget", "--outline", "--bytecode", "--target-cpus"}) {
+        if (reentrant && input.option_exists(opt)) {
+            err << opt << ": " << brain::err_msg(make_error_code(brain_errc::cmd_reentrant_option).message());
+            return 2;
+        }
+    }
+
+    if (input.option_exists("-o")) out_file = input.get_option("-o");
+    else if (emit_obj) out_file = std::string(std::filesystem::path(input.get_input_file()).stem()) + (input.option_exists("-S") ? ".s" : ".o");
+    else out_file = std::filesystem::path(input.get_input_file()).stem();
+
+    // The header for an --abi function goes next to it's object, and only depends on the names and the step budget.
+    if (abi) {
+        std::filesystem::path header = std::filesystem::path(out_file).replace_extension(".h");
+        std::ofstream ofs(header);
+        ofs << code_gen::abi_header(abi_name(input.get_input_file()), std::filesystem::path(input.get_input_file()).filename().string(),
+                                    step_budget(input));
+
+        if (!ofs) {
+            err << brain::err_msg(make_error_code(brain_errc::lower_output).message());
+            return 1;
+        }
+    }
+
+    // On a cache hit there's nothing left to do but copy the output out.
+    std::string key;
+
+    if (cache) {
+        stats.begin("cache");
+        key = cache_key(input, bf_prog.str());
+
+        bool hit = cache->fetch(key, out_file);
+        stats.count("cache_hit", hit);
+
+        if (hit) {
+            report_stats(input, stats, nullptr);
+            return 0;
+        }
+    }
 
     // Build the AST.
+    stats.begin("ast");
     ast_builder ast_pass(bf_prog.str());
     std::shared_ptr<ast> tree = std::make_shared<ast>(brain::root);
     ast_pass.visit(tree);
 
     // Catch the only possible syntax error in bf, unbalanced brackets!
     if (ast_pass.ec != brain_errc::no_err) {
-        std::cerr << brain::err_msg(ast_pass.ec.message(), ast_pass.err_node);
+        err << brain::err_msg(ast_pass.ec.message(), ast_pass.err_node);
         return 1;
     }
 
+    stats.count("ast_nodes", brain::count_nodes(tree));
+    stats.count("depth", depth);
+
+    // Very large programs are stored as bytecode for the runtime's vm, unless asked otherwise. Profiling and
+    // step budgets instrument the native code, so they always use that, as do incremental builds of executables.
+    bool profile = input.option_exists("--profile");
+    bool steps = step_budget(input) > 0;
+    bool incremental = cache && input.option_exists("--incremental") && !emit_obj && !profile && !executor && !steps && !input.option_exists("-g");
+    bool bytecode = !profile && !incremental && !reentrant && !steps && (input.option_exists("--bytecode")
+                                 || (!input.option_exists("--native") && brain::count_nodes(tree) > brain::BYTECODE_THRESHOLD));
+
+    // Fold runs and idioms at the bf level first. Bytecode always wants them, as does a budget since they make
+    // everything after cheaper, while profiling wants the loops as written. A budget can't fall back to bytecode
+    // with a step budget, which only native code counts.
+    bool budget = input.option_exists("--compile-budget") && !bytecode && !profile && !incremental;
+
+    bf_optimizer opt_pass;
+    bool bf_opt = bytecode || budget || (input.get_opt_level() > 0 && !profile);
+
+    if (bf_opt) {
+        stats.begin("bf_opt");
+        opt_pass.visit(tree);
+        stats.count("ast_nodes", brain::count_nodes(tree));
+        stats.count("rewrites", opt_pass.rewrites);
+    }
+
+    if (incremental) {
+        int status = compile_regions(input, *cache, tree, out_file, stack_bytes, stats, err);
+        if (status != 0) return status;
+
+        cache->insert(key, out_file);
+        report_stats(input, stats, nullptr);
+        return 0;
+    }
+
+    // Outlined functions can be compiled in parallel, as separate objects for the linker.
+    size_t threads = compile_threads(input);
+
+    // Pick the level and layout expected to fit the budget, from the program as the bf optimizer left it.
+    brain::compile_plan plan;
+    plan.opt_level = input.get_opt_level();
+    plan.outline = input.option_exists("--outline");
+    plan.bytecode = bytecode;
+
+    if (budget) {
+        stats.begin("plan");
+        double budget_ms = std::stod(input.get_option("--compile-budget"));
+
+        plan = brain::plan_compile(tree, input.get_opt_level(), input.option_exists("--outline"), threads, budget_ms, steps);
+        bytecode = plan.bytecode;
+
+        stats.count("loops", brain::count_loops(tree));
+        stats.count("budget_ms", budget_ms);
+        stats.count("estimate_ms", plan.estimate_ms);
+        stats.note("plan", plan.name());
+    }
+
+    // Executables can be built for several CPU levels at once, unless they're just bytecode for the vm or an executor.
+    if (input.option_exists("--target-cpus") && !emit_obj && !bytecode && !executor) {
+        std::vector<brain::cpu_level> levels;
+
+        if (!brain::parse_cpu_levels(input.get_option("--target-cpus"), levels)
+            || llvm::Triple(llvm::sys::getDefaultTargetTriple()).getArch() != llvm::Triple::x86_64) {
+            err << brain::err_msg(make_error_code(brain_errc::cmd_bad_target_cpus).message());
+            return 2;
+        }
+
+        int status = compile_variants(input, tree, levels, plan, threads, out_file, stack_bytes, stats, err);
+        if (status != 0) return status;
+
+        if (cache) cache->insert(key, out_file);
+        report_stats(input, stats, nullptr);
+        return 0;
+    }
+
     // Initialize the code gen pass and generate the LLVM IR.
-    code_gen gen_pass(input.get_input_file());
+    stats.begin("codegen");
+    code_gen gen_pass(input.get_input_file(), input.option_exists("-g") && !bytecode);
+    gen_pass.profile = profile;
+    gen_pass.outline_size = plan.outline ? brain::OUTLINE_SIZE : 0;
+    if (reentrant) gen_pass.abi_name = abi_name(input.get_input_file());
+    gen_pass.step_budget = step_budget(input);
+    gen_pass.dedup = !input.option_exists("--no-dedup");
+
+    if (input.option_exists("--profile-use") && !brain::read_profile(input.get_option("--profile-use"), gen_pass.prof_use)) {
+        gen_pass.ec = brain_errc::gen_bad_profile;
+    }
+
     gen_pass.initialize_module();
-    gen_pass.visit(tree);
+
+    if (bytecode) {
+        bytecode_gen byte_pass;
+        byte_pass.visit(tree);
+        gen_pass.visit_bytecode(byte_pass.code);
+        stats.count("bytecode_bytes", byte_pass.code.size());
+    } else {
+        gen_pass.visit(tree);
+        if (executor) gen_pass.visit_executor();
+    }
     
     if (gen_pass.ec != brain_errc::no_err) {
-        std::cerr << brain::err_msg(gen_pass.ec.message());
+        err << brain::err_msg(gen_pass.ec.message());
         return 1;
     }
 
+    stats.count("ir_insts", gen_pass.mod->getInstructionCount());
+    stats.count("shared_loops", gen_pass.shared_loops);
+    stats.count("shared_fns", gen_pass.shared_fns);
+
     // Lower the LLVM IR to it's specified target.
     lowering lower_pass(std::move(gen_pass.mod), std::move(gen_pass.machine));
-    lower_pass.optimize(input.get_opt_level());
+    lower_pass.time_passes = input.option_exists("--time-passes") || input.option_exists("--stats-json");
+    lower_pass.collect_remarks = input.option_exists("--opt-report");
+    lower_pass.threads = threads;
+    lower_pass.light = plan.light;
+
+    stats.begin("optimize");
+    lower_pass.optimize(plan.opt_level);
+    stats.count("ir_insts", lower_pass.mod->getInstructionCount());
 
-    // Determine what the object file should be.
-    std::filesystem::path obj_file;
+    // Explain what both the bf optimizer and LLVM did.
+    if (input.option_exists("--opt-report")) {
+        err << "bf optimizer:\n";
+        if (bf_opt) opt_pass.print_report(err);
+        else err << "  not run, " << (profile ? "profiling keeps the loops as written" : "disabled at -O0") << "\n";
 
-    if (input.option_exists("-o") && input.option_exists("-c")) obj_file = input.get_option("-o");
-    else obj_file = std::string(std::filesystem::path(input.get_input_file()).stem()) + (input.option_exists("-S") ? ".s" : ".o");
+        err << "llvm remarks:\n";
+        lower_pass.print_remarks(err);
+    }
 
-    // Compile down the LLVM IR.
-    lower_pass.compile(obj_file, input.option_exists("-S"));
+    // Compile down the LLVM IR, into memory.
+    stats.begin("compile");
+    lower_pass.compile(input.option_exists("-S"));
 
     if (lower_pass.ec != brain_errc::no_err) {
-        std::cerr << brain::err_msg(lower_pass.ec.message());
+        err << brain::err_msg(lower_pass.ec.message());
         return 1;
-    } else if (input.option_exists("-S") || input.option_exists("-c")) {
-        return 0;
     }
 
-    // Get the executible name.
-    std::filesystem::path exe_file;
+    stats.count("object_bytes", lower_pass.object_size());
+    stats.count("parts", std::max<size_t>(lower_pass.parts.size(), 1));
 
-    if (input.option_exists("-o")) exe_file = input.get_option("-o");
-    else exe_file = std::filesystem::path(input.get_input_file()).stem();
+    // Only write the object file out when that's the output asked for.
+    if (emit_obj) {
+        lower_pass.write(out_file);
+    } else {
+        // Link the object file, along with the runtime for the vm, profiler or executor if needed.
+        std::vector<std::string> libs;
+        if (bytecode || profile || executor) libs.push_back(lowering::runtime_lib());
 
-    // Link the object file.
-    lower_pass.link(obj_file, exe_file, input.get_opt_level());
+        stats.begin("link");
+        lower_pass.link(out_file, plan.opt_level, libs);
+    }
+
+    if (lower_pass.ec != brain_errc::no_err) {
+        err << brain::err_msg(lower_pass.ec.message());
+        return 1;
+    }
+
+    // Without lld, linking happens in clang, so its memory use is counted separately. With lld it's part of brainc's.
+    if (!emit_obj) {
+        std::error_code size_ec;
+        stats.count("exe_bytes", std::filesystem::file_size(out_file, size_ec));
+        if (!lowering::links_in_process()) stats.count("clang_peak_rss_kb", brain::peak_rss_kb(true));
+    }
+
+    if (cache) cache->insert(key, out_file);
+
+    report_stats(input, stats, &lower_pass);
+    return 0;
+}
+
+
+// ------------------------------------------------------------
+//  compile_batch
+//
+//  Compile every input file on a pool of worker threads. Each
+//  file gets it's own arguments and error output, so a file
+//  failing doesn't affect the rest.
+// ------------------------------------------------------------
+static int compile_batch(cmd_parser& input, brain::compile_cache* cache) {
+
+    std::vector<std::string> files = input.get_input_files();
+
+    if (input.option_exists("--manifest") && !brain::read_manifest(input.get_option("--manifest"), files)) {
+        std::cerr << brain::err_msg(make_error_code(brain_errc::cmd_bad_manifest).message());
+        return 2;
+    }
+
+    if (files.empty()) {
+        std::cerr << brain::err_msg(make_error_code(brain_errc::cmd_missing_input).message());
+        std::cerr << brain::USAGE;
+        return 2;
+    }
+
+    // Outputs go in the -o directory, or the working directory, named the same as they would be one at a time.
+    std::filesystem::path out_dir = input.option_exists("-o") ? input.get_option("-o") : ".";
+    std::string ext = input.option_exists("-S") ? ".s" : input.option_exists("-c") ? ".o" : "";
+
+    size_t jobs = input.option_exists("--jobs") ? std::stoul(input.get_option("--jobs")) : std::thread::hardware_concurrency();
+
+    std::atomic<size_t> failed{0};
+    std::mutex err_lock;
+    auto start = std::chrono::steady_clock::now();
+
+    brain::run_pool(files.size(), std::max<size_t>(jobs, 1), [&](size_t i) {
+        std::ostringstream err;
+        cmd_parser file_input = input.for_input(files[i], (out_dir / std::filesystem::path(files[i]).stem()).string() + ext);
+
+        if (compile_file(file_input, cache, err) != 0) failed++;
+
+        // Print each file's errors in one go, so they don't interleave.
+        if (!err.str().empty()) {
+            std::lock_guard<std::mutex> guard(err_lock);
+            std::cerr << files[i] << ": " << err.str();
+        }
+    });
+
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cerr << "compiled " << files.size() - failed << " of " << files.size() << " files in " << secs << "s ("
+              << files.size() / secs << " files/s, " << std::max<size_t>(jobs, 1) << " jobs)\n";
+
+    return failed ? 1 : 0;
+}
+
+
+// ------------------------------------------------------------
+//  compile_program
+//
+//  Compile a single program of a bundle into part, with it's
+//  main renamed to fn_name, as native code or as bytecode for
+//  the vm the same as it would be on it's own.
+// ------------------------------------------------------------
+static int compile_program(cmd_parser& input, const std::string& file, const std::string& fn_name, lowering& part, bool& bytecode,
+                           std::ostream& err, bool deep = false) {
+
+    std::string src = read_file(file);
+
+    if (src.empty() && !std::filesystem::is_regular_file(file)) {
+        err << brain::err_msg(make_error_code(brain_errc::cmd_invalid_input).message());
+        return 2;
+    }
+
+    size_t stack_bytes = brain::stack_for_depth(brain::nesting_depth(src));
+
+    if (stack_bytes && !deep) {
+        int status = 1;
+        brain::run_with_stack(stack_bytes, [&] { status = compile_program(input, file, fn_name, part, bytecode, err, true); });
+        return status;
+    }
+
+    ast_builder ast_pass(src);
+    std::shared_ptr<ast> tree = std::make_shared<ast>(brain::root);
+    ast_pass.visit(tree);
+
+    if (ast_pass.ec != brain_errc::no_err) {
+        err << brain::err_msg(ast_pass.ec.message(), ast_pass.err_node);
+        return 1;
+    }
+
+    // Step budgets are only counted by native code, the same as for a program on it's own.
+    bool steps = step_budget(input) > 0;
+    bytecode = !steps && (input.option_exists("--bytecode") || (!input.option_exists("--native") && brain::count_nodes(tree) > brain::BYTECODE_THRESHOLD));
+
+    if (bytecode || input.get_opt_level() > 0) {
+        bf_optimizer opt_pass;
+        opt_pass.visit(tree);
+    }
+
+    code_gen gen_pass(file, input.option_exists("-g") && !bytecode);
+    gen_pass.step_budget = step_budget(input);
+    gen_pass.dedup = !input.option_exists("--no-dedup");
+
+    if (!gen_pass.initialize_module()) {
+        err << brain::err_msg(gen_pass.ec.message());
+        return 1;
+    }
+
+    if (bytecode) {
+        bytecode_gen byte_pass;
+        byte_pass.visit(tree);
+        gen_pass.visit_bytecode(byte_pass.code);
+    } else {
+        gen_pass.visit(tree);
+    }
+
+    if (gen_pass.ec != brain_errc::no_err) {
+        err << brain::err_msg(gen_pass.ec.message());
+        return 1;
+    }
+
+    // Only the bundle's main is visible outside the executable.
+    llvm::Function* main = gen_pass.mod->getFunction("main");
+    main->setName(fn_name);
+    main->setVisibility(llvm::GlobalValue::HiddenVisibility);
+
+    part.ctx = std::move(gen_pass.ctx);
+    part.mod = std::move(gen_pass.mod);
+    part.machine = std::move(gen_pass.machine);
+
+    part.optimize(input.get_opt_level());
+    part.compile();
+
+    if (part.ec != brain_errc::no_err) {
+        err << brain::err_msg(part.ec.message());
+        return 1;
+    }
+
+    return 0;
+}
+
+
+// ------------------------------------------------------------
+//  compile_bundle
+//
+//  Compile every input file into one executable, like busybox.
+//  The programs are compiled in parallel, then linked with a
+//  main that runs the one named by argv[0] or argv[1], so they
+//  share the startup code, runtime and libc instead of every
+//  program having it's own copy on disk and in memory.
+// ------------------------------------------------------------
+static int compile_bundle(cmd_parser& input) {
+
+    // Every program is built the same plain way, so options that change how a program is built or run on it's own
+    // would be silently ignored.
+    for (const char* opt : {"--profile", "--profile-use", "--abi", "--executor", "--target-cpus", "--outline", "-c", "-S"}) {
+        if (input.option_exists(opt)) {
+            std::cerr << opt << ": " << brain::err_msg(make_error_code(brain_errc::cmd_bundle_option).message());
+            return 2;
+        }
+    }
+
+    brain::compile_stats stats;
+    stats.begin("read");
+
+    std::vector<std::string> files = input.get_input_files();
+
+    if (input.option_exists("--manifest") && !brain::read_manifest(input.get_option("--manifest"), files)) {
+        std::cerr << brain::err_msg(make_error_code(brain_errc::cmd_bad_manifest).message());
+        return 2;
+    }
+
+    if (files.empty()) {
+        std::cerr << brain::err_msg(make_error_code(brain_errc::cmd_missing_input).message());
+        std::cerr << brain::USAGE;
+        return 2;
+    }
+
+    // Programs are run by their file names, while their mains are numbered so any name makes a valid symbol.
+    std::vector<std::pair<std::string, std::string> > programs;
+    std::set<std::string> names;
+
+    for (size_t i = 0; i < files.size(); i++) {
+        std::string name = std::filesystem::path(files[i]).stem().string();
+
+        if (!names.insert(name).second) {
+            std::cerr << files[i] << ": " << brain::err_msg(make_error_code(brain_errc::cmd_bad_bundle).message());
+            return 2;
+        }
+
+        programs.push_back({name, "brain_main_" + std::to_string(i) + "_" + abi_name(files[i])});
+    }
+
+    std::filesystem::path out_file = input.option_exists("-o") ? input.get_option("-o") : "bundle";
+    size_t jobs = input.option_exists("--jobs") ? std::stoul(input.get_option("--jobs")) : std::thread::hardware_concurrency();
+
+    // Every program gets it's own part, with it's own context, so they can all be compiled at once.
+    stats.begin("compile");
+    std::vector<std::unique_ptr<lowering> > parts(files.size());
+    std::vector<std::string> errors(files.size());
+    std::atomic<size_t> failed{0}, bytecode_cnt{0};
 
-    // Since we lowered all the way to an executible, we now want to delete the object file.
-    std::filesystem::remove(obj_file);
+    brain::run_pool(files.size(), std::max<size_t>(jobs, 1), [&](size_t i) {
+        std::ostringstream err;
+        bool bytecode = false;
+        parts[i] = std::make_unique<lowering>();
+
+        if (compile_program(input, files[i], programs[i].second, *parts[i], bytecode, err) != 0) failed++;
+
+        bytecode_cnt += bytecode;
+        errors[i] = err.str();
+    });
+
+    for (size_t i = 0; i < files.size(); i++) {
+        if (!errors[i].empty()) std::cerr << files[i] << ": " << errors[i];
+    }
+
+    if (failed) return 1;
+
+    stats.count("programs", files.size());
+    stats.count("bytecode_programs", bytecode_cnt);
+
+    // The bundle's own main, which only needs the names.
+    code_gen gen_pass(out_file.string());
+
+    if (!gen_pass.initialize_module()) {
+        std::cerr << brain::err_msg(gen_pass.ec.message());
+        return 1;
+    }
+
+    gen_pass.visit_bundle(programs);
+
+    lowering lower_pass(std::move(gen_pass.mod), std::move(gen_pass.machine));
+    lower_pass.compile();
+    lower_pass.parts = std::move(parts);
+
+    stats.count("object_bytes", lower_pass.object_size());
+
+    // The runtime is always linked, since brain_rt_bundle is in it.
+    stats.begin("link");
+    if (lower_pass.ec == brain_errc::no_err) lower_pass.link(out_file, input.get_opt_level(), {lowering::runtime_lib()});
 
     if (lower_pass.ec != brain_errc::no_err) {
         std::cerr << brain::err_msg(lower_pass.ec.message());
         return 1;
     }
 
+    std::error_code size_ec;
+    stats.count("exe_bytes", std::filesystem::file_size(out_file, size_ec));
+
+    report_stats(input, stats, nullptr);
+    return 0;
+}
+
+
+// ------------------------------------------------------------
+//  warm_up
+//
+//  Compile a small program all the way to an object, so the
+//  targets, pass registries and code pages are all ready
+//  before the compile server forks off it's first request.
+// ------------------------------------------------------------
+static void warm_up() {
+
+    ast_builder ast_pass("+[->+>++<<]>[-<.>]");
+    std::shared_ptr<ast> tree = std::make_shared<ast>(brain::root);
+    ast_pass.visit(tree);
+
+    bf_optimizer opt_pass;
+    opt_pass.visit(tree);
+
+    code_gen gen_pass("warm-up.bf");
+    if (!gen_pass.initialize_module()) return;
+    gen_pass.visit(tree);
+
+    lowering lower_pass(std::move(gen_pass.mod), std::move(gen_pass.machine));
+    lower_pass.optimize(2);
+    lower_pass.compile(false);
+}
+
+
+// ------------------------------------------------------------
+//  run_jit
+//
+//  Compile the input file in memory with the JIT, then run it
+//  on stdin and stdout straight away.
+// ------------------------------------------------------------
+static int run_jit(cmd_parser& input) {
+
+    if (!input.check_input_file()) {
+        std::cerr << brain::err_msg(input.ec.message());
+        std::cerr << brain::USAGE;
+        return 2;
+    }
+
+    brain::jit_options options;
+    options.opt_level = input.get_opt_level();
+
+    std::error_code ec;
+    std::shared_ptr<const brain::jit_program> program = brain::compile(read_file(input.get_input_file()), options, ec);
+
+    if (!program) {
+        std::cerr << brain::err_msg(ec.message());
+        return 1;
+    }
+
+    brain::jit_io io;
+    io.read = [](void*) { return getchar(); };
+    io.write = [](void*, uint8_t c) { putchar(c); };
+
+    std::vector<uint8_t> tape(brain::CELL_SIZE, 0);
+    program->run(tape.data(), io);
+
+    fflush(stdout);
     return 0;
-}
\ No newline at end of file
+}
+
+
+// ------------------------------------------------------------
+//  run
+//
+//  Everything after the help and version, and the part of
+//  brainc the compile server runs for each request.
+// ------------------------------------------------------------
+static int run(cmd_parser& input) {
+
+    // Everything after reads the numeric options as they are.
+    if (!input.check_values()) {
+        std::cerr << input.bad_value << ": " << brain::err_msg(input.ec.message());
+        return 2;
+    }
+
+    // Set up the compile cache, if it's wanted.
+    bool use_cache = input.option_exists("--cache") || input.option_exists("--cache-dir") || input.option_exists("--cache-stats")
+                     || input.option_exists("--incremental");
+    std::string cache_size = input.option_exists("--cache-size") ? input.get_option("--cache-size") : "";
+
+    brain::compile_cache cache(input.option_exists("--cache-dir") ? input.get_option("--cache-dir") : brain::default_cache_dir(),
+                               (cache_size.empty() ? brain::CACHE_SIZE_MB : std::stoull(cache_size)) << 20);
+
+    // Print the cache's counters and exit.
+    if (input.option_exists("--cache-stats")) {
+        uint64_t entries, bytes;
+        cache.read_counters(entries, bytes);
+
+        std::cout << "cache: " << cache.dir << "\n"
+                  << "hits: " << cache.hits << ", misses: " << cache.misses << "\n"
+                  << "entries: " << entries << ", " << bytes << " of " << cache.limit << " bytes\n";
+        return 0;
+    }
+
+    if (input.option_exists("--jit")) return run_jit(input);
+
+    // A manifest adds to a bundle just as it does a batch, so this goes first.
+    if (input.option_exists("--bundle")) return compile_bundle(input);
+
+    if (input.option_exists("--batch") || input.option_exists("--manifest")) return compile_batch(input, use_cache ? &cache : nullptr);
+
+    return compile_file(input, use_cache ? &cache : nullptr, std::cerr);
+}
+
+
+int main(int argc, char** argv) {
+
+    // Initialize the command argument parser.
+    cmd_parser input(argc, argv);
+
+    // Printing the help message takes priority over all other input arguments.
+    if (input.option_exists("-h") || input.option_exists("--help") || input.option_exists("help")) {
+        std::cout << brain::VERSION << std::endl << brain::USAGE << brain::OPTIONS << std::endl;
+        return 0;
+    }
+
+    // Print the version and exit.
+    if (input.option_exists("-v") || input.option_exists("--version")) {
+        std::cout << brain::VERSION;
+        return 0;
+    }
+
+    std::string socket = input.option_exists("--socket") ? input.get_option("--socket") : brain::default_socket();
+    std::error_code ec;
+
+    // Serve compiles until interrupted, each request being run just as if it were our own command line.
+    if (input.option_exists("--serve")) {
+        warm_up();
+
+        brain::serve(socket, [](std::vector<std::string> args) {
+            cmd_parser request(std::move(args));
+            return run(request);
+        }, ec);
+
+        if (ec) std::cerr << brain::err_msg(ec.message());
+        return ec ? 1 : 0;
+    }
+
+    // With $BRAINC_SERVER set, use the server if it's there, so existing scripts can use it unchanged.
+    if (input.option_exists("--client") || getenv("BRAINC_SERVER")) {
+        int status = brain::forward(socket, input.for_server(), ec);
+
+        if (!ec) return status;
+        if (input.option_exists("--client") || ec != brain_errc::cmd_no_server) {
+            std::cerr << brain::err_msg(ec.message());
+            return ec == brain_errc::cmd_no_server ? 2 : 1;
+        }
+    }
+
+    return run(input);
+}
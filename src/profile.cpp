@@ -0,0 +1,44 @@
+// ------------------------------------------------------------
+//  profile.cpp
+//  
+//  Parsing of the profile reports, see runtime_profile.cpp for
+//  the writing side.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "profile.h"
+
+
+// ------------------------------------------------------------
+//  read_profile
+// 
+//  Read each "loop <line> <col> <entries> <iterations> ..."
+//  record. Comments and other records are skipped.
+// ------------------------------------------------------------
+bool brain::read_profile(const std::string& path, brain::profile_map& prof) {
+
+    std::ifstream ifs(path);
+    if (!ifs) return false;
+
+    std::string line;
+    while (std::getline(ifs, line)) {
+        std::istringstream rec(line);
+        std::string kind;
+        size_t l, c;
+        brain::loop_counts counts;
+
+        if (!(rec >> kind) || kind != "loop") continue;
+        if (!(rec >> l >> c >> counts.entries >> counts.iterations)) return false;
+
+        // The same loop can show up more than once when reports are concatenated, so sum them.
+        brain::loop_counts& total = prof[{l, c}];
+        total.entries += counts.entries, total.iterations += counts.iterations;
+    }
+
+    return true;
+}
@@ -0,0 +1,80 @@
+// ------------------------------------------------------------
+//  regions.cpp
+//
+//  Regions are cut where the hash of the last few top level
+//  nodes hits a given pattern, rather than every n ops. That
+//  way, after an insertion or deletion the cuts fall back in
+//  the same places a little further on, and the regions after
+//  that point are the same as before.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "regions.h"
+#include "util.h"
+
+
+// Number of top level nodes hashed to decide on a cut, and how often a cut is made on average.
+static const size_t WINDOW = 3;
+static const uint64_t CUT_EVERY = 8;
+
+
+// ------------------------------------------------------------
+//  fnv1a
+//
+//  Stable across builds and platforms, unlike std::hash.
+// ------------------------------------------------------------
+static uint64_t fnv1a(const std::string& s) {
+
+    uint64_t h = 14695981039346656037ull;
+
+    for (unsigned char c : s) {
+        h ^= c;
+        h *= 1099511628211ull;
+    }
+
+    return h;
+}
+
+
+// ------------------------------------------------------------
+//  split_regions
+//
+//  Regions are at least half the size asked for, and are cut
+//  at twice the size whatever the hash says.
+// ------------------------------------------------------------
+std::vector<brain::region> brain::split_regions(const std::shared_ptr<ast>& root, size_t size) {
+
+    std::vector<region> regions(1);
+    std::vector<std::string> window;
+    size_t ops = 0;
+
+    for (const std::shared_ptr<ast>& c : root->children) {
+        std::string text;
+        brain::encode(c, text);
+
+        regions.back().nodes.push_back(c);
+        regions.back().text += text;
+        ops += brain::count_nodes(c) + 1;
+
+        window.push_back(text);
+        if (window.size() > WINDOW) window.erase(window.begin());
+
+        std::string recent;
+        for (const std::string& w : window) recent += w + "|";
+
+        if ((ops >= size / 2 && fnv1a(recent) % CUT_EVERY == 0) || ops >= 2 * size) {
+            regions.emplace_back();
+            ops = 0;
+        }
+    }
+
+    if (regions.back().nodes.empty()) regions.pop_back();
+
+    return regions;
+}
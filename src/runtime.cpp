@@ -0,0 +1,29 @@
+// ------------------------------------------------------------
+//  runtime.cpp
+//
+//  Runtime support linked into the executables brainc makes.
+//  Kept free of the C++ standard library and the compiler's
+//  headers, so it links with a plain C driver.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <cstdint>
+
+#include "vm.h"
+
+
+// ------------------------------------------------------------
+//  brain_rt_run
+//
+//  Entry point for bytecode mode executables. main passes in
+//  the program embedded in its read only data.
+// ------------------------------------------------------------
+extern "C" int brain_rt_run(const uint8_t* code) {
+
+    // The tape lives in bss rather than on the stack, same size as the compiled code's.
+    static uint8_t tape[brain::VM_TAPE_SIZE];
+
+    brain::vm_run(code, tape);
+    return 0;
+}
@@ -0,0 +1,67 @@
+// ------------------------------------------------------------
+//  runtime_bundle.cpp
+//
+//  Runtime side of --bundle. The generated main passes in the
+//  name and main of every program in the executable, and the
+//  one to run is picked by the name the executable was run
+//  as, like busybox, or else by it's first argument.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <cstdio>
+#include <cstring>
+
+
+// The main of a single program in the bundle.
+typedef int (*bf_main)();
+
+
+// ------------------------------------------------------------
+//  find
+//
+//  Index of the program with the given name, or -1. Bundles
+//  are small enough that looking through them all is fine.
+// ------------------------------------------------------------
+static int find(const char* name, const char* const* names, int count) {
+
+    for (int i = 0; i < count; i++) {
+        if (!strcmp(name, names[i])) return i;
+    }
+
+    return -1;
+}
+
+
+// ------------------------------------------------------------
+//  brain_rt_bundle
+//
+//  Run the program named by argv[0], without it's directory,
+//  or by argv[1]. --list prints every name, one per line, for
+//  making the links.
+// ------------------------------------------------------------
+extern "C" int brain_rt_bundle(const char* const* names, const bf_main* mains, int count, int argc, char** argv) {
+
+    const char* self = argc > 0 ? argv[0] : "bundle";
+    const char* slash = strrchr(self, '/');
+    if (slash) self = slash + 1;
+
+    int i = find(self, names, count);
+    if (i >= 0) return mains[i]();
+
+    // Run as the bundle itself, so the program is the first argument.
+    if (argc > 1 && !strcmp(argv[1], "--list")) {
+        for (i = 0; i < count; i++) puts(names[i]);
+        return 0;
+    }
+
+    if (argc > 1 && (i = find(argv[1], names, count)) >= 0) return mains[i]();
+
+    if (argc > 1) fprintf(stderr, "%s: no program named %s, the programs in this bundle are:\n", self, argv[1]);
+    else fprintf(stderr, "%s: give the program to run, one of:\n", self);
+
+    for (i = 0; i < count; i++) fprintf(stderr, "  %s\n", names[i]);
+
+    // The same as a shell that can't find a command.
+    return 127;
+}
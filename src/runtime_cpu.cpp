@@ -0,0 +1,90 @@
+// ------------------------------------------------------------
+//  runtime_cpu.cpp
+//
+//  Runtime side of --target-cpus. The generated main asks for
+//  the x86-64 level of the machine it's running on, then runs
+//  the highest variant that level allows. The checks follow
+//  the x86-64 psABI, including that the OS saves the AVX and
+//  AVX-512 registers.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <cstdio>
+#include <cstdint>
+
+
+#if defined(__x86_64__)
+
+// ------------------------------------------------------------
+//  cpuid / xgetbv
+//
+//  Inline rather than from the compiler's headers, so this
+//  builds the same with any compiler.
+// ------------------------------------------------------------
+static void cpuid(uint32_t leaf, uint32_t sub, uint32_t regs[4]) {
+    asm volatile("cpuid" : "=a"(regs[0]), "=b"(regs[1]), "=c"(regs[2]), "=d"(regs[3]) : "a"(leaf), "c"(sub));
+}
+
+static uint64_t xgetbv() {
+    uint32_t lo, hi;
+    asm volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+
+    return ((uint64_t) hi << 32) | lo;
+}
+
+// Whether all of the bits in mask are set.
+static bool has(uint32_t reg, uint32_t mask) { return (reg & mask) == mask; }
+
+#endif
+
+
+// ------------------------------------------------------------
+//  brain_rt_cpu_level
+//
+//  1 for plain x86-64, up to 4 for x86-64-v4. Anything else
+//  is level 0, and runs nothing.
+// ------------------------------------------------------------
+extern "C" int brain_rt_cpu_level() {
+
+#if defined(__x86_64__)
+    uint32_t basic[4], ext[4], leaf1[4] = {}, leaf7[4] = {}, ext1[4] = {};
+
+    cpuid(0, 0, basic);
+    cpuid(0x80000000, 0, ext);
+
+    if (basic[0] >= 1) cpuid(1, 0, leaf1);
+    if (basic[0] >= 7) cpuid(7, 0, leaf7);
+    if (ext[0] >= 0x80000001) cpuid(0x80000001, 0, ext1);
+
+    // sse3, ssse3, cx16, sse4.1, sse4.2 and popcnt, then lahf/sahf.
+    if (!has(leaf1[2], 1u << 0 | 1u << 9 | 1u << 13 | 1u << 19 | 1u << 20 | 1u << 23) || !has(ext1[2], 1u << 0)) return 1;
+
+    // fma, movbe, xsave, osxsave, avx and f16c, then bmi, avx2 and bmi2, then lzcnt, with the OS saving ymm.
+    if (!has(leaf1[2], 1u << 12 | 1u << 22 | 1u << 26 | 1u << 27 | 1u << 28 | 1u << 29)) return 2;
+    if (!has(leaf7[1], 1u << 3 | 1u << 5 | 1u << 8) || !has(ext1[2], 1u << 5)) return 2;
+
+    uint64_t xcr0 = xgetbv();
+    if ((xcr0 & 0x6) != 0x6) return 2;
+
+    // avx512f, dq, cd, bw and vl, with the OS saving the mask and zmm registers.
+    if (!has(leaf7[1], 1u << 16 | 1u << 17 | 1u << 28 | 1u << 30 | 1u << 31) || (xcr0 & 0xe0) != 0xe0) return 3;
+
+    return 4;
+#else
+    return 0;
+#endif
+}
+
+
+// ------------------------------------------------------------
+//  brain_rt_cpu_unsupported
+//
+//  Called by main when even the lowest variant is too high a
+//  level for this machine. Returns the exit code.
+// ------------------------------------------------------------
+extern "C" int brain_rt_cpu_unsupported(int lowest) {
+
+    fprintf(stderr, "error: this CPU doesn't support x86-64-v%d, the lowest level this program was built for\n", lowest);
+    return 1;
+}
@@ -0,0 +1,371 @@
+// ------------------------------------------------------------
+//  runtime_exec.cpp
+//
+//  Runtime side of --executor. Every instance of the program
+//  runs as a coroutine on one scheduler thread, with it's own
+//  stack and tape. The generated code does it's I/O through
+//  bf_io like in --abi mode, and when a read or write would
+//  block the instance switches back to the scheduler, which
+//  waits on epoll for whichever instances can go on. Given a
+//  socket path it runs one instance per connection until
+//  killed, otherwise just the one on stdin and stdout.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <ucontext.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "vm.h"
+
+
+// Same layout as the bf_io in the header --abi writes out, see code_gen::abi_header.
+struct bf_io {
+    void* user;
+    int (*read)(void* user);
+    void (*write)(void* user, uint8_t c);
+};
+
+typedef int (*bf_program)(uint8_t* tape, size_t len, bf_io* io);
+
+// The generated code only ever calls back into the I/O below, so a small stack is plenty.
+static const size_t STACK_SIZE = 64 * 1024;
+static const size_t BUF_SIZE = 4096;
+
+// A running copy of the program, and where it's input comes from and output goes.
+struct instance {
+    ucontext_t ctx;
+    int in, out;
+    bool in_polled, out_polled, eof, done;
+    int status;
+
+    size_t in_pos, in_len, out_len;
+    uint8_t in_buf[BUF_SIZE], out_buf[BUF_SIZE];
+    uint8_t tape[brain::VM_TAPE_SIZE];
+
+    instance* next;
+};
+
+// An instance is mapped as a guard page, it's stack, then the struct itself, so that only the pages that get
+// touched take up memory, and a stack overflow faults instead of running into the tape.
+static const size_t PAGE = 4096;
+static const size_t INSTANCE_PAGES = (sizeof(instance) + PAGE - 1) / PAGE;
+static const size_t MAPPING_SIZE = PAGE + STACK_SIZE + INSTANCE_PAGES * PAGE;
+
+// The scheduler's state. There's only ever one, on the thread that called brain_rt_exec.
+static bf_program program = nullptr;
+static ucontext_t scheduler;
+static int epoll_fd = -1;
+static instance* current = nullptr;
+static instance* ready_head = nullptr, *ready_tail = nullptr;
+static size_t live = 0;
+
+// Marks the listening socket's events apart from the instances'.
+static char listener_tag;
+
+
+// ------------------------------------------------------------
+//  make_ready
+//
+//  Queue an instance to run the next time around.
+// ------------------------------------------------------------
+static void make_ready(instance* inst) {
+
+    inst->next = nullptr;
+
+    if (ready_tail) ready_tail->next = inst;
+    else ready_head = inst;
+
+    ready_tail = inst;
+}
+
+
+// ------------------------------------------------------------
+//  wait_for
+//
+//  Switch back to the scheduler until fd is ready. Regular
+//  files can't be polled, but never block either, so those
+//  carry straight on.
+// ------------------------------------------------------------
+static void wait_for(instance* inst, int fd, uint32_t events) {
+
+    bool& polled = fd == inst->in ? inst->in_polled : inst->out_polled;
+
+    epoll_event ev{};
+    ev.events = events | EPOLLONESHOT;
+    ev.data.ptr = inst;
+
+    if (epoll_ctl(epoll_fd, polled ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &ev) != 0) return;
+    polled = true;
+
+    swapcontext(&inst->ctx, &scheduler);
+}
+
+
+// ------------------------------------------------------------
+//  flush
+//
+//  Write out everything buffered. If the other end has gone
+//  away, the output is dropped.
+// ------------------------------------------------------------
+static void flush(instance* inst) {
+
+    size_t sent = 0;
+
+    while (sent < inst->out_len) {
+        ssize_t n = inst->out == STDOUT_FILENO ? write(inst->out, inst->out_buf + sent, inst->out_len - sent)
+                                               : send(inst->out, inst->out_buf + sent, inst->out_len - sent, MSG_NOSIGNAL);
+
+        if (n > 0) sent += n;
+        else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) wait_for(inst, inst->out, EPOLLOUT);
+        else if (n < 0 && errno == EINTR) continue;
+        else break;
+    }
+
+    inst->out_len = 0;
+}
+
+
+// ------------------------------------------------------------
+//  exec_read / exec_write
+//
+//  The instance's bf_io. Output is buffered, and flushed
+//  before waiting on input so an interactive program's prompt
+//  gets through first.
+// ------------------------------------------------------------
+static int exec_read(void* user) {
+
+    instance* inst = (instance*) user;
+
+    while (inst->in_pos == inst->in_len) {
+        if (inst->eof) return EOF;
+
+        ssize_t n = read(inst->in, inst->in_buf, BUF_SIZE);
+
+        if (n > 0) {
+            inst->in_pos = 0, inst->in_len = n;
+        } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            flush(inst);
+            wait_for(inst, inst->in, EPOLLIN);
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else {
+            inst->eof = true;
+        }
+    }
+
+    return inst->in_buf[inst->in_pos++];
+}
+
+static void exec_write(void* user, uint8_t c) {
+
+    instance* inst = (instance*) user;
+
+    inst->out_buf[inst->out_len++] = c;
+    if (inst->out_len == BUF_SIZE) flush(inst);
+}
+
+
+// ------------------------------------------------------------
+//  start
+//
+//  Where every instance begins. Returning switches back to
+//  the scheduler through uc_link.
+// ------------------------------------------------------------
+static void start() {
+
+    instance* inst = current;
+    bf_io io{inst, exec_read, exec_write};
+
+    inst->status = program(inst->tape, sizeof(inst->tape), &io);
+    flush(inst);
+
+    inst->done = true;
+}
+
+
+// ------------------------------------------------------------
+//  spawn / finish
+//
+//  Create an instance reading from in and writing to out, or
+//  tear one down once it's done.
+// ------------------------------------------------------------
+static bool spawn(int in, int out) {
+
+    void* mapping = mmap(nullptr, MAPPING_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (mapping == MAP_FAILED) return false;
+
+    uint8_t* base = (uint8_t*) mapping;
+    mprotect(base, PAGE, PROT_NONE);
+
+    // Fresh anonymous pages are already zeroed, so only the fields that start out otherwise need setting.
+    instance* inst = (instance*) (base + PAGE + STACK_SIZE);
+    inst->in = in, inst->out = out;
+
+    getcontext(&inst->ctx);
+    inst->ctx.uc_stack.ss_sp = base + PAGE;
+    inst->ctx.uc_stack.ss_size = STACK_SIZE;
+    inst->ctx.uc_link = &scheduler;
+    makecontext(&inst->ctx, start, 0);
+
+    live++;
+    make_ready(inst);
+
+    return true;
+}
+
+static int finish(instance* inst) {
+
+    int status = inst->status;
+
+    // Closing the descriptors also takes them out of epoll. The standard streams are left for exit to deal with.
+    if (inst->in > STDERR_FILENO) close(inst->in);
+    if (inst->out > STDERR_FILENO && inst->out != inst->in) close(inst->out);
+
+    munmap((uint8_t*) inst - PAGE - STACK_SIZE, MAPPING_SIZE);
+    live--;
+
+    return status;
+}
+
+
+// ------------------------------------------------------------
+//  accept_all
+//
+//  Start an instance for every connection waiting on the
+//  listening socket.
+// ------------------------------------------------------------
+static void accept_all(int listener) {
+
+    while (true) {
+        int conn = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+        if (conn < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) perror("error: accept");
+            return;
+        }
+
+        if (!spawn(conn, conn)) close(conn);
+    }
+}
+
+
+// ------------------------------------------------------------
+//  listen_on
+//
+//  Listen on a Unix socket at path, replacing any stale one
+//  left behind. Returns the descriptor, or -1.
+// ------------------------------------------------------------
+static int listen_on(const char* path) {
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+
+    if (strlen(path) >= sizeof(addr.sun_path)) return -1;
+    strcpy(addr.sun_path, path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+
+    unlink(path);
+
+    if (bind(fd, (sockaddr*) &addr, sizeof(addr)) != 0 || listen(fd, SOMAXCONN) != 0) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+
+// ------------------------------------------------------------
+//  brain_rt_exec
+//
+//  The generated main for --executor, which hands over the
+//  program and it's arguments. Returns the exit code.
+// ------------------------------------------------------------
+extern "C" int brain_rt_exec(bf_program fn, int argc, char** argv) {
+
+    program = fn;
+
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) {
+        perror("error: epoll");
+        return 1;
+    }
+
+    // Every instance needs a descriptor, so allow as many as we're able to.
+    rlimit files;
+    if (getrlimit(RLIMIT_NOFILE, &files) == 0 && files.rlim_cur < files.rlim_max) {
+        files.rlim_cur = files.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &files);
+    }
+
+    int listener = -1;
+
+    if (argc > 1) {
+        listener = listen_on(argv[1]);
+
+        if (listener < 0) {
+            fprintf(stderr, "error: can't listen on %s\n", argv[1]);
+            return 1;
+        }
+
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.ptr = &listener_tag;
+        epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listener, &ev);
+    } else {
+        // Just the one instance, on the standard streams, which are put back to blocking afterwards.
+        fcntl(STDIN_FILENO, F_SETFL, fcntl(STDIN_FILENO, F_GETFL) | O_NONBLOCK);
+        fcntl(STDOUT_FILENO, F_SETFL, fcntl(STDOUT_FILENO, F_GETFL) | O_NONBLOCK);
+
+        spawn(STDIN_FILENO, STDOUT_FILENO);
+    }
+
+    int status = 0;
+    epoll_event events[256];
+
+    while (live > 0 || listener >= 0) {
+
+        // Run everything that's ready until it blocks or finishes.
+        while (ready_head) {
+            current = ready_head;
+            ready_head = current->next;
+            if (!ready_head) ready_tail = nullptr;
+
+            swapcontext(&scheduler, &current->ctx);
+            if (current->done) status = finish(current);
+        }
+
+        current = nullptr;
+        if (live == 0 && listener < 0) break;
+
+        int n = epoll_wait(epoll_fd, events, sizeof(events) / sizeof(events[0]), -1);
+
+        for (int i = 0; i < n; i++) {
+            if (events[i].data.ptr == &listener_tag) accept_all(listener);
+            else make_ready((instance*) events[i].data.ptr);
+        }
+    }
+
+    if (argc <= 1) {
+        fcntl(STDIN_FILENO, F_SETFL, fcntl(STDIN_FILENO, F_GETFL) & ~O_NONBLOCK);
+        fcntl(STDOUT_FILENO, F_SETFL, fcntl(STDOUT_FILENO, F_GETFL) & ~O_NONBLOCK);
+    }
+
+    close(epoll_fd);
+    return status;
+}
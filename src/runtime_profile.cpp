@@ -0,0 +1,128 @@
+// ------------------------------------------------------------
+//  runtime_profile.cpp
+//
+//  Runtime side of --profile. The generated code counts loop
+//  entries and iterations, and accesses to each tape cell. At
+//  exit this writes the counts out as a report.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+
+
+// Static description of a loop, laid out by code_gen::init_profile.
+struct brain_rt_loop {
+    int32_t line, chr;
+
+    // Tape accesses and I/O bytes made directly by one iteration of the body.
+    int32_t cells, io;
+};
+
+
+// Everything the report needs, registered once at startup.
+static const char* prof_name;
+static const brain_rt_loop* prof_loops;
+static const uint64_t* prof_counts;
+static const uint64_t* prof_hist;
+static uint64_t prof_loop_cnt, prof_hist_size;
+
+
+// ------------------------------------------------------------
+//  by_iterations
+//
+//  qsort comparator, ordering loop indices hottest first.
+// ------------------------------------------------------------
+static int by_iterations(const void* a, const void* b) {
+    uint64_t x = prof_counts[2 * *(const uint64_t*) a + 1], y = prof_counts[2 * *(const uint64_t*) b + 1];
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+
+// ------------------------------------------------------------
+//  write_report
+//
+//  Write the report at exit. The lines starting with # are a
+//  summary for people, the rest are records for tools such as
+//  brainc --profile-use.
+// ------------------------------------------------------------
+static void write_report() {
+
+    // Write <source stem>.prof in the working directory, unless told otherwise.
+    char path[4096];
+    const char* env = getenv("BF_PROFILE_FILE");
+    const char* base = strrchr(prof_name, '/') ? strrchr(prof_name, '/') + 1 : prof_name;
+    const char* ext = strrchr(base, '.');
+
+    if (env) snprintf(path, sizeof(path), "%s", env);
+    else snprintf(path, sizeof(path), "%.*s.prof", (int) (ext && ext != base ? ext - base : strlen(base)), base);
+
+    FILE* f = fopen(path, "w");
+    if (!f) return;
+
+    // Find the range of the tape that was actually used.
+    uint64_t lo = prof_hist_size, hi = 0;
+    for (uint64_t i = 0; i < prof_hist_size; i++) {
+        if (prof_hist[i]) hi = i, lo = lo < i ? lo : i;
+    }
+
+    fprintf(f, "# bf profile of %s\n#\n", prof_name);
+
+    if (lo <= hi) fprintf(f, "# tape range used: %llu to %llu (%llu cells)\n#\n", (unsigned long long) lo, (unsigned long long) hi, (unsigned long long) (hi - lo + 1));
+    else fprintf(f, "# tape range used: none\n#\n");
+
+    // Sort the loops by iterations, and list the hottest ones.
+    uint64_t* order = (uint64_t*) malloc(sizeof(uint64_t) * (prof_loop_cnt + 1));
+    for (uint64_t i = 0; i < prof_loop_cnt; i++) order[i] = i;
+    qsort(order, prof_loop_cnt, sizeof(uint64_t), by_iterations);
+
+    fprintf(f, "# hottest loops:\n#   %-12s %14s %14s %12s %16s %14s\n", "line:col", "iterations", "entries", "avg trip", "cell accesses", "io bytes");
+
+    for (uint64_t i = 0; i < prof_loop_cnt && i < 10; i++) {
+        const brain_rt_loop& l = prof_loops[order[i]];
+        uint64_t entries = prof_counts[2 * order[i]], iters = prof_counts[2 * order[i] + 1];
+
+        char pos[32];
+        snprintf(pos, sizeof(pos), "%d:%d", l.line, l.chr);
+
+        // Each entry and iteration also reads the cell for the loop condition.
+        fprintf(f, "#   %-12s %14llu %14llu %12.1f %16llu %14llu\n", pos, (unsigned long long) iters, (unsigned long long) entries,
+                entries ? (double) iters / entries : 0.0, (unsigned long long) (iters * l.cells + entries + iters), (unsigned long long) (iters * l.io));
+    }
+
+    free(order);
+
+    // Then all the raw records, loops in source order and the non-zero cells.
+    fprintf(f, "#\n# loop <line> <col> <entries> <iterations> <cell accesses> <io bytes>\n# cell <index> <accesses>\n");
+
+    for (uint64_t i = 0; i < prof_loop_cnt; i++) {
+        uint64_t entries = prof_counts[2 * i], iters = prof_counts[2 * i + 1];
+        fprintf(f, "loop %d %d %llu %llu %llu %llu\n", prof_loops[i].line, prof_loops[i].chr, (unsigned long long) entries,
+                (unsigned long long) iters, (unsigned long long) (iters * prof_loops[i].cells + entries + iters), (unsigned long long) (iters * prof_loops[i].io));
+    }
+
+    for (uint64_t i = 0; i < prof_hist_size; i++) {
+        if (prof_hist[i]) fprintf(f, "cell %llu %llu\n", (unsigned long long) i, (unsigned long long) prof_hist[i]);
+    }
+
+    fclose(f);
+}
+
+
+// ------------------------------------------------------------
+//  brain_rt_profile_init
+//
+//  Called at the start of main in --profile executables, with
+//  the counters the generated code updates.
+// ------------------------------------------------------------
+extern "C" void brain_rt_profile_init(const char* name, const brain_rt_loop* loops, const uint64_t* counts, uint64_t loop_cnt,
+                                      const uint64_t* hist, uint64_t hist_size) {
+
+    prof_name = name, prof_loops = loops, prof_counts = counts, prof_loop_cnt = loop_cnt;
+    prof_hist = hist, prof_hist_size = hist_size;
+
+    atexit(write_report);
+}
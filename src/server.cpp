@@ -0,0 +1,335 @@
+// ------------------------------------------------------------
+//  server.cpp
+//
+//  A request is the client's working directory and arguments,
+//  as length prefixed strings, with it's stdin, stdout and
+//  stderr passed along as file descriptors. The reply is just
+//  the exit code. Every request runs in a fork of the server,
+//  so it gets the already initialized LLVM for free, while
+//  a crash or a chdir can't affect any other request.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cerrno>
+#include <cstdlib>
+#include <cstdint>
+#include <csignal>
+#include <iostream>
+#include <filesystem>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include "server.h"
+#include "bf_error.h"
+
+
+// Requests bigger than this are rejected, a command line is nowhere near it.
+static const uint32_t MAX_REQUEST = 1 << 20;
+
+// Set by SIGINT and SIGTERM to stop accepting requests.
+static volatile sig_atomic_t stopping = 0;
+
+static void on_stop(int) { stopping = 1; }
+
+
+// ------------------------------------------------------------
+//  socket_addr
+//
+//  Fill in the address for a socket path, returning false if
+//  the path is too long to fit.
+// ------------------------------------------------------------
+static bool socket_addr(const std::string& path, sockaddr_un& addr) {
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+
+    if (path.empty() || path.size() >= sizeof(addr.sun_path)) return false;
+
+    memcpy(addr.sun_path, path.c_str(), path.size());
+    return true;
+}
+
+
+// ------------------------------------------------------------
+//  connect_to
+//
+//  Connect to a socket path, returning the descriptor or -1.
+// ------------------------------------------------------------
+static int connect_to(const std::string& path) {
+
+    sockaddr_un addr;
+    if (!socket_addr(path, addr)) return -1;
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+
+    if (connect(fd, (sockaddr*) &addr, sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+
+// ------------------------------------------------------------
+//  read_all / write_all
+//
+//  Loop until all n bytes are through, or the connection is
+//  closed. Writing to a closed connection mustn't raise
+//  SIGPIPE.
+// ------------------------------------------------------------
+static bool read_all(int fd, char* buf, size_t n) {
+
+    while (n > 0) {
+        ssize_t r = read(fd, buf, n);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) return false;
+
+        buf += r, n -= r;
+    }
+
+    return true;
+}
+
+static bool write_all(int fd, const char* buf, size_t n) {
+
+    while (n > 0) {
+        ssize_t w = send(fd, buf, n, MSG_NOSIGNAL);
+        if (w < 0 && errno == EINTR) continue;
+        if (w <= 0) return false;
+
+        buf += w, n -= w;
+    }
+
+    return true;
+}
+
+
+// ------------------------------------------------------------
+//  handle
+//
+//  Run a single request, in the forked child. The request's
+//  length comes along with the client's descriptors.
+// ------------------------------------------------------------
+static void handle(int conn, const std::function<int(std::vector<std::string>)>& handler) {
+
+    uint32_t len;
+    int fds[3];
+
+    char control[CMSG_SPACE(sizeof(fds))];
+    iovec iov{&len, sizeof(len)};
+    msghdr msg{};
+    msg.msg_iov = &iov, msg.msg_iovlen = 1;
+    msg.msg_control = control, msg.msg_controllen = sizeof(control);
+
+    if (recvmsg(conn, &msg, MSG_WAITALL) != sizeof(len)) return;
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    if (!cmsg || cmsg->cmsg_type != SCM_RIGHTS || cmsg->cmsg_len != CMSG_LEN(sizeof(fds))) return;
+    memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+
+    // Split the rest of the request back up into strings.
+    if (len > MAX_REQUEST) return;
+
+    std::string req(len, '\0');
+    if (!read_all(conn, req.data(), len)) return;
+
+    std::vector<std::string> args;
+
+    for (size_t i = 0; i + sizeof(uint32_t) <= req.size();) {
+        uint32_t n;
+        memcpy(&n, &req[i], sizeof(n));
+        i += sizeof(n);
+
+        if (n > req.size() - i) return;
+        args.push_back(req.substr(i, n));
+        i += n;
+    }
+
+    // Take on the client's streams and working directory.
+    if (args.size() < 2 || chdir(args[0].c_str()) != 0) return;
+
+    for (int i = 0; i < 3; i++) {
+        dup2(fds[i], i);
+        close(fds[i]);
+    }
+
+    int status = handler(std::vector<std::string>(args.begin() + 1, args.end()));
+
+    std::cout.flush();
+    std::cerr.flush();
+
+    int32_t reply = status;
+    write_all(conn, (const char*) &reply, sizeof(reply));
+}
+
+
+// ------------------------------------------------------------
+//  default_socket
+//
+//  Keep the socket somewhere only this user can get at, when
+//  there's a runtime directory.
+// ------------------------------------------------------------
+std::string brain::default_socket() {
+
+    if (const char* env = getenv("BRAINC_SERVER")) return env;
+    if (const char* run = getenv("XDG_RUNTIME_DIR")) return (std::filesystem::path(run) / "brainc.sock").string();
+
+    return (std::filesystem::temp_directory_path() / ("brainc-" + std::to_string(getuid()) + ".sock")).string();
+}
+
+
+// ------------------------------------------------------------
+//  serve
+//
+//  Listen on the socket and fork off a child per request. The
+//  children are reaped automatically, and the socket is
+//  removed again on SIGINT or SIGTERM.
+// ------------------------------------------------------------
+void brain::serve(const std::string& socket, const std::function<int(std::vector<std::string>)>& handler, std::error_code& ec) {
+
+    sockaddr_un addr;
+    if (!socket_addr(socket, addr)) {
+        ec = brain_errc::cmd_bad_socket;
+        return;
+    }
+
+    // A socket left behind by a server that's gone can be replaced, but not one that's still answering.
+    int other = connect_to(socket);
+    if (other >= 0) {
+        close(other);
+        ec = brain_errc::cmd_bad_socket;
+        return;
+    }
+
+    unlink(socket.c_str());
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    // Only this user may connect, since requests run with our permissions.
+    mode_t mask = umask(0077);
+    bool listening = fd >= 0 && bind(fd, (sockaddr*) &addr, sizeof(addr)) == 0 && listen(fd, SOMAXCONN) == 0;
+    umask(mask);
+
+    if (!listening) {
+        if (fd >= 0) close(fd);
+        ec = brain_errc::cmd_bad_socket;
+        return;
+    }
+
+    // No SA_RESTART, so accept returns when we're told to stop.
+    struct sigaction stop{}, reap{}, old_int, old_term, old_chld;
+    stop.sa_handler = on_stop;
+    reap.sa_handler = SIG_IGN;
+
+    sigaction(SIGINT, &stop, &old_int);
+    sigaction(SIGTERM, &stop, &old_term);
+    sigaction(SIGCHLD, &reap, &old_chld);
+
+    std::cout.flush();
+    std::cerr.flush();
+
+    while (!stopping) {
+        int conn = accept4(fd, nullptr, nullptr, SOCK_CLOEXEC);
+
+        // Running short of descriptors or memory passes once requests finish, so wait a little rather than spin.
+        // Anything else won't get better by trying again.
+        if (conn < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+
+            if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM) {
+                usleep(100000);
+                continue;
+            }
+
+            ec = brain_errc::cmd_server_accept;
+            break;
+        }
+
+        pid_t pid = fork();
+
+        if (pid == 0) {
+            close(fd);
+
+            // The request waits on it's own children, e.g. clang when linking, so they can't be reaped for it.
+            sigaction(SIGINT, &old_int, nullptr);
+            sigaction(SIGTERM, &old_term, nullptr);
+            sigaction(SIGCHLD, &old_chld, nullptr);
+
+            handle(conn, handler);
+            _exit(0);
+        }
+
+        // If the fork failed, closing the connection tells the client.
+        close(conn);
+    }
+
+    close(fd);
+    unlink(socket.c_str());
+
+    sigaction(SIGINT, &old_int, nullptr);
+    sigaction(SIGTERM, &old_term, nullptr);
+    sigaction(SIGCHLD, &old_chld, nullptr);
+}
+
+
+// ------------------------------------------------------------
+//  forward
+//
+//  Send the request in one go, with our standard streams
+//  attached to the first byte of it.
+// ------------------------------------------------------------
+int brain::forward(const std::string& socket, const std::vector<std::string>& args, std::error_code& ec) {
+
+    int fd = connect_to(socket);
+    if (fd < 0) {
+        ec = brain_errc::cmd_no_server;
+        return 1;
+    }
+
+    std::error_code cwd_ec;
+    std::vector<std::string> parts{std::filesystem::current_path(cwd_ec).string()};
+    parts.insert(parts.end(), args.begin(), args.end());
+
+    std::string req(sizeof(uint32_t), '\0');
+    for (const std::string& p : parts) {
+        uint32_t n = p.size();
+        req.append((const char*) &n, sizeof(n)).append(p);
+    }
+
+    uint32_t len = req.size() - sizeof(uint32_t);
+    memcpy(&req[0], &len, sizeof(len));
+
+    int fds[3] = {0, 1, 2};
+    char control[CMSG_SPACE(sizeof(fds))] = {};
+    iovec iov{req.data(), req.size()};
+    msghdr msg{};
+    msg.msg_iov = &iov, msg.msg_iovlen = 1;
+    msg.msg_control = control, msg.msg_controllen = sizeof(control);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET, cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    ssize_t sent = sendmsg(fd, &msg, MSG_NOSIGNAL);
+    int32_t reply;
+
+    bool ok = sent > 0 && write_all(fd, req.data() + sent, req.size() - sent) && read_all(fd, (char*) &reply, sizeof(reply));
+    close(fd);
+
+    if (!ok) {
+        ec = brain_errc::cmd_server_lost;
+        return 1;
+    }
+
+    return reply;
+}
@@ -0,0 +1,138 @@
+// ------------------------------------------------------------
+//  stats.cpp
+//
+//  Collecting and reporting the --stats measurements.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <string>
+#include <iomanip>
+#include <algorithm>
+#include <sys/resource.h>
+
+#include "stats.h"
+
+
+// ------------------------------------------------------------
+//  begin
+//
+//  Start the clock on a new phase.
+// ------------------------------------------------------------
+void brain::compile_stats::begin(const std::string& name) {
+
+    end();
+
+    phase current;
+    current.name = name;
+    phases.push_back(current);
+    start = std::chrono::steady_clock::now();
+    open = true;
+}
+
+
+// ------------------------------------------------------------
+//  end
+//
+//  Stop the clock on the current phase, and note the peak
+//  memory use up to this point.
+// ------------------------------------------------------------
+void brain::compile_stats::end() {
+
+    if (!open) return;
+
+    phases.back().wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    phases.back().peak_rss_kb = brain::peak_rss_kb();
+    open = false;
+}
+
+
+// ------------------------------------------------------------
+//  count
+//
+//  Attach a count to the latest phase.
+// ------------------------------------------------------------
+void brain::compile_stats::count(const std::string& name, uint64_t val) {
+
+    if (!phases.empty()) phases.back().counts.push_back({name, val});
+}
+
+
+// ------------------------------------------------------------
+//  note
+//
+//  Attach a note to the latest phase.
+// ------------------------------------------------------------
+void brain::compile_stats::note(const std::string& name, const std::string& text) {
+
+    if (!phases.empty()) phases.back().notes.push_back({name, text});
+}
+
+
+// ------------------------------------------------------------
+//  print
+//
+//  Print the phases out as a table.
+// ------------------------------------------------------------
+void brain::compile_stats::print(std::ostream& os) const {
+
+    double total = 0;
+    uint64_t peak = 0;
+
+    os << std::left << std::setw(12) << "phase" << std::right << std::setw(12) << "wall (ms)" << std::setw(16) << "peak rss (KiB)" << "  sizes\n";
+
+    for (const phase& p : phases) {
+        os << std::left << std::setw(12) << p.name << std::right << std::fixed << std::setprecision(3) << std::setw(12) << p.wall_ms << std::setw(16) << p.peak_rss_kb << " ";
+        for (const auto& [name, val] : p.counts) os << " " << name << "=" << val;
+        for (const auto& [name, text] : p.notes) os << " " << name << "=" << text;
+        os << "\n";
+
+        total += p.wall_ms, peak = std::max(peak, p.peak_rss_kb);
+    }
+
+    os << std::left << std::setw(12) << "total" << std::right << std::setw(12) << total << std::setw(16) << peak << "\n";
+}
+
+
+// ------------------------------------------------------------
+//  write_json
+//
+//  Write the phases out as a JSON object. The counts and notes
+//  become fields of their phase.
+// ------------------------------------------------------------
+void brain::compile_stats::write_json(std::ostream& os, const std::string& llvm_timers) const {
+
+    double total = 0;
+    uint64_t peak = 0;
+
+    os << "{\n  \"phases\": [";
+
+    for (size_t i = 0; i < phases.size(); i++) {
+        const phase& p = phases[i];
+
+        os << (i ? ",\n" : "\n") << "    {\"name\": \"" << p.name << "\", \"wall_ms\": " << std::fixed << std::setprecision(3) << p.wall_ms
+           << ", \"peak_rss_kb\": " << p.peak_rss_kb;
+        for (const auto& [name, val] : p.counts) os << ", \"" << name << "\": " << val;
+        for (const auto& [name, text] : p.notes) os << ", \"" << name << "\": \"" << text << "\"";
+        os << "}";
+
+        total += p.wall_ms, peak = std::max(peak, p.peak_rss_kb);
+    }
+
+    os << "\n  ],\n  \"total_wall_ms\": " << total << ",\n  \"peak_rss_kb\": " << peak;
+    os << ",\n  \"llvm_timers\": {" << llvm_timers << "\n  }\n}\n";
+}
+
+
+// ------------------------------------------------------------
+//  peak_rss_kb
+//
+//  ru_maxrss is already in KiB on Linux.
+// ------------------------------------------------------------
+uint64_t brain::peak_rss_kb(bool children) {
+
+    struct rusage usage;
+    if (getrusage(children ? RUSAGE_CHILDREN : RUSAGE_SELF, &usage)) return 0;
+
+    return usage.ru_maxrss;
+}
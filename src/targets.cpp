@@ -0,0 +1,54 @@
+// ------------------------------------------------------------
+//  targets.cpp
+//
+//  The features of each level are given explicitly rather
+//  than by the level's CPU name, which older LLVMs don't have.
+//  They have to agree with brain_rt_cpu_level in the runtime.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <string>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+
+#include "targets.h"
+
+
+// Each level has everything the one before it does.
+static const std::string V2 = "+cx16,+sahf,+popcnt,+sse3,+ssse3,+sse4.1,+sse4.2";
+static const std::string V3 = V2 + ",+avx,+avx2,+bmi,+bmi2,+f16c,+fma,+lzcnt,+movbe,+xsave";
+static const std::string V4 = V3 + ",+avx512f,+avx512bw,+avx512cd,+avx512dq,+avx512vl";
+
+static const std::vector<brain::cpu_level> LEVELS = {
+    {"x86-64", 1, ""},
+    {"x86-64-v2", 2, V2},
+    {"x86-64-v3", 3, V3},
+    {"x86-64-v4", 4, V4},
+};
+
+
+// ------------------------------------------------------------
+//  parse_cpu_levels
+//
+//  Split the list on commas, and look up each name.
+// ------------------------------------------------------------
+bool brain::parse_cpu_levels(const std::string& list, std::vector<cpu_level>& levels) {
+
+    std::istringstream iss(list);
+    std::string name;
+
+    levels.clear();
+
+    while (std::getline(iss, name, ',')) {
+        auto it = std::find_if(LEVELS.begin(), LEVELS.end(), [&](const cpu_level& l) { return l.name == name; });
+        if (it == LEVELS.end()) return false;
+
+        if (std::none_of(levels.begin(), levels.end(), [&](const cpu_level& l) { return l.level == it->level; })) levels.push_back(*it);
+    }
+
+    std::sort(levels.begin(), levels.end(), [](const cpu_level& a, const cpu_level& b) { return a.level < b.level; });
+
+    return !levels.empty();
+}
@@ -8,6 +8,7 @@
 // Include statements.
 #include <cassert>
 #include <iostream>
+#include <algorithm>
 
 #include "util.h"
 #include "ast.h"
@@ -46,16 +47,80 @@ void brain::print_prog(std::shared_ptr<ast>& t) {
     
     // Print this node's information.
     if (t->token == brain::loop) std::cout << "[";
+    else if (t->token == brain::branch) std::cout << "branch[";
     else if (t->token != brain::root) std::cout << token_name(t->token);
 
     // Print out the children nodes.
     for (auto child : t->children) print_prog(child);
 
-    if (t->token == brain::loop) std::cout << "]";
+    if (t->token == brain::loop || t->token == brain::branch) std::cout << "]";
     else if (t->token == brain::root) std::cout << "\n";
 }
 
 
+// ------------------------------------------------------------
+//  count_nodes
+// 
+//  Count the ops in the program, used to pick a compile mode.
+// ------------------------------------------------------------
+size_t brain::count_nodes(const std::shared_ptr<ast>& t) {
+
+    // Count this node, unless it's the root, and all of it's children.
+    size_t cnt = t->token != brain::root;
+    for (auto child : t->children) cnt += count_nodes(child);
+
+    return cnt;
+}
+
+
+// ------------------------------------------------------------
+//  nesting_depth
+// 
+//  One pass over the source, before there's an AST to recurse
+//  through, so it's cheap whatever the program looks like.
+// ------------------------------------------------------------
+size_t brain::nesting_depth(const std::string& prog) {
+
+    size_t depth = 0, deepest = 0;
+
+    for (char c : prog) {
+        if (c == '[') deepest = std::max(deepest, ++depth);
+        else if (c == ']' && depth) depth--;
+    }
+
+    return deepest;
+}
+
+
+// ------------------------------------------------------------
+//  encode
+// 
+//  Plain tokens are written as they are, folded ones with
+//  their operands. Loops and branches wrap their children.
+// ------------------------------------------------------------
+void brain::encode(const std::shared_ptr<ast>& t, std::string& out) {
+
+    switch (t->token) {
+        case brain::root:
+        case brain::loop:
+        case brain::branch:
+            out += t->token == brain::root ? "" : t->token == brain::loop ? "[" : "{";
+            for (auto child : t->children) encode(child, out);
+            out += t->token == brain::root ? "" : t->token == brain::loop ? "]" : "}";
+            break;
+        case brain::add:
+        case brain::move:
+        case brain::clear:
+        case brain::mul:
+        case brain::scan:
+            out += "(" + token_name(t->token) + " " + std::to_string(t->val) + " " + std::to_string(t->off) + ")";
+            break;
+        default:
+            out += token_name(t->token);
+    }
+}
+
+
 // ------------------------------------------------------------
 //  token_name
 // 
@@ -77,6 +142,18 @@ std::string brain::token_name(brain::token tok) {
             return "<";
         case brain::rarrow:
             return ">";
+        case brain::add:
+            return "add";
+        case brain::move:
+            return "move";
+        case brain::clear:
+            return "clear";
+        case brain::mul:
+            return "mul";
+        case brain::scan:
+            return "scan";
+        case brain::branch:
+            return "branch";
         case brain::loop:
             return "loop";
         case brain::root:
@@ -0,0 +1,119 @@
+// ------------------------------------------------------------
+//  vm.cpp
+//
+//  Dispatch loop of the bf virtual machine. Uses computed
+//  gotos where the compiler supports them, and a plain switch
+//  otherwise.
+// ------------------------------------------------------------
+
+
+// Include statements.
+#include <cstdio>
+#include <cstdint>
+
+#include "vm.h"
+
+
+#if defined(__GNUC__)
+#define VM_THREADED 1
+#define TARGET(o) l_##o:
+#define DISPATCH() goto *labels[*ip]
+#else
+#define VM_THREADED 0
+#define TARGET(o) case brain::o:
+#define DISPATCH() continue
+#endif
+
+
+// ------------------------------------------------------------
+//  read16 / read32
+//
+//  Read a little endian operand. These compile down to plain
+//  loads on little endian targets.
+// ------------------------------------------------------------
+static inline uint16_t read16(const uint8_t* p) {
+    return p[0] | p[1] << 8;
+}
+
+static inline uint32_t read32(const uint8_t* p) {
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t) p[3] << 24;
+}
+
+
+// ------------------------------------------------------------
+//  vm_run
+//
+//  Run the program to completion. Every handler ends by
+//  jumping straight to the handler of the next instruction.
+// ------------------------------------------------------------
+void brain::vm_run(const uint8_t* code, uint8_t* tape) {
+
+    const uint8_t* ip = code;
+    uint16_t head = 0;
+
+#if VM_THREADED
+    // Must be in the same order as brain::opcode.
+    static void* const labels[brain::op_count] = {
+        &&l_op_add, &&l_op_move, &&l_op_out, &&l_op_in, &&l_op_jz,
+        &&l_op_jnz, &&l_op_clear, &&l_op_mul, &&l_op_scan, &&l_op_halt
+    };
+
+    DISPATCH();
+#else
+    for (;;) switch (*ip) {
+#endif
+
+    TARGET(op_add)
+        tape[head] += ip[1];
+        ip += 2;
+        DISPATCH();
+
+    TARGET(op_move)
+        head += read16(ip + 1);
+        ip += 3;
+        DISPATCH();
+
+    TARGET(op_out)
+        putchar(tape[head]);
+        ip++;
+        DISPATCH();
+
+    TARGET(op_in)
+        tape[head] = getchar();
+        ip++;
+        DISPATCH();
+
+    TARGET(op_jz)
+        ip = tape[head] ? ip + 5 : code + read32(ip + 1);
+        DISPATCH();
+
+    TARGET(op_jnz)
+        ip = tape[head] ? code + read32(ip + 1) : ip + 5;
+        DISPATCH();
+
+    TARGET(op_clear)
+        tape[head] = 0;
+        ip++;
+        DISPATCH();
+
+    TARGET(op_mul)
+        tape[static_cast<uint16_t>(head + read16(ip + 1))] += tape[head] * ip[3];
+        ip += 4;
+        DISPATCH();
+
+    TARGET(op_scan) {
+        uint16_t stride = read16(ip + 1);
+        while (tape[head]) head += stride;
+        ip += 3;
+        DISPATCH();
+    }
+
+    TARGET(op_halt)
+        return;
+
+#if !VM_THREADED
+        default:
+            return;
+    }
+#endif
+}
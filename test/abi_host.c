@@ -0,0 +1,95 @@
+/* ------------------------------------------------------------
+ *  abi_host.c
+ *
+ *  Host program for testing brainc --abi. Runs the function
+ *  named by BF_RUN, from the header included on the command
+ *  line, on several threads at once with the same input, and
+ *  prints the output once all the runs agree on it. A run may
+ *  only run out of steps if the header says it can, and then
+ *  the host exits with BF_OUT_OF_STEPS.
+ * ------------------------------------------------------------ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#define THREADS 4
+
+/* What a run can return, with a step budget compiled in or without. */
+#ifdef BF_OUT_OF_STEPS
+#define RUN_OK(status) ((status) == 0 || (status) == BF_OUT_OF_STEPS)
+#else
+#define RUN_OK(status) ((status) == 0)
+#endif
+
+
+/* A run's own tape and buffers. */
+struct run {
+    uint8_t tape[BF_TAPE_SIZE];
+    const uint8_t* in;
+    size_t in_len, in_pos;
+    uint8_t* out;
+    size_t out_len, out_cap;
+    int status;
+};
+
+static int read_byte(void* user) {
+    struct run* r = user;
+    return r->in_pos < r->in_len ? r->in[r->in_pos++] : -1;
+}
+
+static void write_byte(void* user, uint8_t c) {
+    struct run* r = user;
+
+    if (r->out_len == r->out_cap) {
+        r->out_cap = r->out_cap ? 2 * r->out_cap : 256;
+        r->out = realloc(r->out, r->out_cap);
+    }
+
+    r->out[r->out_len++] = c;
+}
+
+static void* run_thread(void* arg) {
+    struct run* r = arg;
+    bf_io io = {r, read_byte, write_byte};
+
+    r->status = BF_RUN(r->tape, sizeof(r->tape), &io);
+    return NULL;
+}
+
+int main(void) {
+
+    /* Read all of stdin up front, so every run sees the same input. */
+    size_t len = 0, cap = 4096;
+    uint8_t* in = malloc(cap);
+
+    for (size_t n; (n = fread(in + len, 1, cap - len, stdin)) > 0;) {
+        len += n;
+        if (len == cap) in = realloc(in, cap *= 2);
+    }
+
+    /* A tape that's too short is turned away. */
+    uint8_t small[16];
+    bf_io none = {NULL, read_byte, write_byte};
+    if (BF_RUN(small, sizeof(small), &none) != -1) return 1;
+
+    static struct run runs[THREADS];
+    pthread_t threads[THREADS];
+
+    for (int i = 0; i < THREADS; i++) {
+        runs[i].in = in, runs[i].in_len = len;
+        pthread_create(&threads[i], NULL, run_thread, &runs[i]);
+    }
+
+    for (int i = 0; i < THREADS; i++) pthread_join(threads[i], NULL);
+
+    for (int i = 0; i < THREADS; i++) {
+        if (!RUN_OK(runs[i].status) || runs[i].status != runs[0].status) return 1;
+        if (runs[i].out_len != runs[0].out_len || memcmp(runs[i].out, runs[0].out, runs[0].out_len) != 0) return 1;
+    }
+
+    fwrite(runs[0].out, 1, runs[0].out_len, stdout);
+    return runs[0].status;
+}
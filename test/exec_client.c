@@ -0,0 +1,91 @@
+/* ------------------------------------------------------------
+ *  exec_client.c
+ *
+ *  Client for testing brainc --executor. Opens all of the
+ *  connections first, so every instance is running at once,
+ *  then sends each one the same input from stdin. Prints the
+ *  output once all of them agree on it, and how long they
+ *  took on stderr.
+ * ------------------------------------------------------------ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+
+/* Read until the other end closes, into a growing buffer. */
+static uint8_t* read_all(int fd, size_t* len) {
+    size_t cap = 4096;
+    uint8_t* buf = malloc(cap);
+    ssize_t n;
+
+    *len = 0;
+
+    while ((n = read(fd, buf + *len, cap - *len)) > 0) {
+        *len += n;
+        if (*len == cap) buf = realloc(buf, cap *= 2);
+    }
+
+    return buf;
+}
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+int main(int argc, char** argv) {
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: exec_client <socket> <connections>\n");
+        return 2;
+    }
+
+    int count = atoi(argv[2]);
+    int* conns = malloc(count * sizeof(int));
+
+    struct sockaddr_un addr = {0};
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, argv[1], sizeof(addr.sun_path) - 1);
+
+    size_t in_len;
+    uint8_t* in = read_all(STDIN_FILENO, &in_len);
+
+    for (int i = 0; i < count; i++) {
+        conns[i] = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (connect(conns[i], (struct sockaddr*) &addr, sizeof(addr)) != 0) return 1;
+    }
+
+    double start = now_ms();
+
+    for (int i = 0; i < count; i++) {
+        if (in_len && write(conns[i], in, in_len) != (ssize_t) in_len) return 1;
+        shutdown(conns[i], SHUT_WR);
+    }
+
+    size_t first_len = 0;
+    uint8_t* first = NULL;
+
+    for (int i = 0; i < count; i++) {
+        size_t len;
+        uint8_t* out = read_all(conns[i], &len);
+        close(conns[i]);
+
+        if (!first) first = out, first_len = len;
+        else if (len != first_len || memcmp(out, first, len) != 0) return 1;
+        else free(out);
+    }
+
+    double ms = now_ms() - start;
+    fprintf(stderr, "%d instances in %.1f ms, %.0f per second\n", count, ms, count / (ms / 1e3));
+
+    fwrite(first, 1, first_len, stdout);
+    return 0;
+}
@@ -0,0 +1,7 @@
+Prints a line with a loop that has two copies outside of any other loop
++[>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>++++++++++++++++++++++++++++++++.[-]<>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>++++++++++.[-]<-]
+then something else
+>+++++++++++++++++++++++++++++++++.[-]<
++[>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>++++++++++++++++++++++++++++++++.[-]<>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>++++++++++.[-]<-]
+and a copy run twice inside another loop
+++[>+[>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>++++++++++++++++++++++++++++++++.[-]<>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<>++++++++++.[-]<-]<-]
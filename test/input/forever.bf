@@ -0,0 +1,2 @@
+Prints Hello World then spins forever
+++++++++[>++++[>++>+++>+++>+<<<<-]>+>+>->>+[<]<-]>>.>---.+++++++..+++.>>.<-.<.+++.------.--------.>>+.>++.[>+<]
@@ -0,0 +1,5 @@
+Moves a letter two cells over and back then prints it and the next one
+++++++++[->++++++++<]>+
+[->>+<<]>>[-<<+>>]<<.+.
+and again three cells over inside a loop that prints the next two
+>++[<[->>>+<<<]>>>[-<<<+>>>]<<<+.>-]
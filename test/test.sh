@@ -5,6 +5,16 @@
 #  
 #    Testing script that, given a test name, runs the associated
 #    test and checks that it's output matches the expected.
+#    Any extra arguments are passed along to brainc, or with
+#    --vm the program is run by brainvm instead, or with --jit
+#    by brainc's JIT. With --batch it's compiled through brainc's
+#    batch mode, and with --abi it's linked into abi_host.c.
+#    With --listen <n> it's built with --executor, and run for
+#    n connections at once from exec_client.c. With --bf-opt
+#    it's rewritten by bf-opt, then run as plain bf by brainvm.
+#    With --bundle it's compiled into one bundle along with all
+#    the other tests and run by name, or through a link named
+#    after it with --bundle-link.
 #   ------------------------------------------------------------
 
 
@@ -12,24 +22,60 @@
 ROOT_DIR="$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && cd ../ && pwd )"
 
 BRAINC="$ROOT_DIR/bin/brainc"
+BRAINVM="$ROOT_DIR/bin/brainvm"
+BFOPT="$ROOT_DIR/bin/bf-opt"
 INPUT="$ROOT_DIR/test/input/$1.bf"
 OUTPUT="$ROOT_DIR/test/output/$1.out"
 STDIN="$ROOT_DIR/test/stdin/$1.in"
-TEMP="$ROOT_DIR/test/temp"
-TEMP_OUT="$ROOT_DIR/test/temp.txt"
+TEMP="$ROOT_DIR/test/temp.$$"
+TEMP_OUT="$ROOT_DIR/test/temp.$$.txt"
 
 # Make sure the input and output are both regular files.
 test ! -f $INPUT -o ! -f $OUTPUT -o ! -f $BRAINC && exit 1
 
 # Run the brainc compiler with the given input, and compare the output.
-$BRAINC $INPUT -o $TEMP &> /dev/null
+if [ "$2" == "--vm" ]; then
+    RUN="$BRAINVM $INPUT ${@:3}"
+elif [ "$2" == "--bf-opt" ]; then
+    $BFOPT $INPUT -o $TEMP.bf &> /dev/null
+    RUN="$BRAINVM $TEMP.bf -O0"
+elif [ "$2" == "--jit" ]; then
+    RUN="$BRAINC $INPUT --jit ${@:3}"
+elif [ "$2" == "--abi" ]; then
+    $BRAINC $INPUT --abi -o $TEMP.o "${@:3}" &> /dev/null
+    cc -pthread -include $TEMP.h -DBF_RUN=bf_${1//-/_} $ROOT_DIR/test/abi_host.c $TEMP.o -o $TEMP &> /dev/null
+    rm -f $TEMP.o $TEMP.h
+    RUN=$TEMP
+elif [ "$2" == "--listen" ]; then
+    $BRAINC $INPUT --executor -o $TEMP.exec "${@:4}" &> /dev/null
+    cc $ROOT_DIR/test/exec_client.c -o $TEMP &> /dev/null
+    $TEMP.exec $TEMP.sock &> /dev/null &
+    EXEC_PID=$!
+    for i in $(seq 50); do test -S $TEMP.sock && break; sleep 0.1; done
+    RUN="$TEMP $TEMP.sock $3"
+elif [ "$2" == "--batch" ]; then
+    mkdir -p $TEMP.d
+    $BRAINC --batch $INPUT -o $TEMP.d "${@:3}" &> /dev/null
+    mv $TEMP.d/$1 $TEMP 2> /dev/null
+    rm -rf $TEMP.d
+    RUN=$TEMP
+elif [ "$2" == "--bundle" -o "$2" == "--bundle-link" ]; then
+    mkdir -p $TEMP.d
+    $BRAINC --bundle $ROOT_DIR/test/input/*.bf -o $TEMP.d/bundle "${@:3}" &> /dev/null
+    ln -s bundle $TEMP.d/$1
+    test "$2" == "--bundle" && RUN="$TEMP.d/bundle $1" || RUN=$TEMP.d/$1
+else
+    $BRAINC $INPUT -o $TEMP "${@:2}" &> /dev/null
+    RUN=$TEMP
+fi
 
-test -f $STDIN && $TEMP < $STDIN > $TEMP_OUT || $TEMP > $TEMP_OUT
+test -f $STDIN && $RUN < $STDIN > $TEMP_OUT || $RUN < /dev/null > $TEMP_OUT
+test -n "$EXEC_PID" && kill $EXEC_PID && rm -f $TEMP.exec $TEMP.sock
 if ! diff <(sed -e '$a\' $TEMP_OUT) <(sed -e '$a\' $OUTPUT) > /dev/null
 then
-    rm -f $TEMP $TEMP_OUT
+    rm -rf $TEMP $TEMP.bf $TEMP.d $TEMP_OUT
     exit 1
 fi
 
 # Remove the temp files regardless.
-rm -f $TEMP $TEMP_OUT
\ No newline at end of file
+rm -rf $TEMP $TEMP.bf $TEMP.d $TEMP_OUT
\ No newline at end of file